@@ -15,24 +15,25 @@ namespace kx {
 
     float AdaptiveFarPlaneCalculator::UpdateAndGetFarPlane(const PooledFrameRenderData& frameData) {
         if (!ShouldRecalculate()) {
-            return m_currentFarPlane;
+            return GetCurrentFarPlane();
         }
         
         m_lastRecalc = std::chrono::steady_clock::now();
         
         auto distances = CollectGadgetDistances(frameData);
         float targetFarPlane = CalculateTargetFarPlane(distances);
-        float oldFarPlane = m_currentFarPlane;
+        float oldFarPlane = GetCurrentFarPlane();
         
         // Apply temporal smoothing to prevent jarring visual changes when scene depth fluctuates
-        m_currentFarPlane = m_currentFarPlane + (targetFarPlane - m_currentFarPlane) * AdaptiveScaling::SMOOTHING_FACTOR;
+        float newFarPlane = oldFarPlane + (targetFarPlane - oldFarPlane) * AdaptiveScaling::SMOOTHING_FACTOR;
+        m_currentFarPlane.store(newFarPlane, std::memory_order_relaxed);
         
         LogFarPlaneUpdate(distances.size(), targetFarPlane, oldFarPlane);
-        return m_currentFarPlane;
+        return newFarPlane;
     }
 
     void AdaptiveFarPlaneCalculator::Reset() {
-        m_currentFarPlane = AdaptiveScaling::FAR_PLANE_INITIAL;
+        m_currentFarPlane.store(AdaptiveScaling::FAR_PLANE_INITIAL, std::memory_order_relaxed);
         m_lastRecalc = std::chrono::steady_clock::now();
     }
 
@@ -46,11 +47,13 @@ namespace kx {
         // Rationale: Players and NPCs are limited to ~200m by game mechanics,
         // but objects (waypoints, vistas, resource nodes) can be 1000m+ away.
         // Using only object distances gives us the true scene depth for intelligent scaling.
+        // Read from the entity table's distance column, which the filter stage fills for every row
+        const EntityTable& table = frameData.table;
         std::vector<float> distances;
         distances.reserve(frameData.gadgets.size());
         
-        for (const auto* g : frameData.gadgets) {
-            if (g) distances.push_back(g->gameplayDistance);
+        for (size_t i = 0; i < table.Size(); ++i) {
+            if (table.entityTypes[i] == ESPEntityType::Gadget) distances.push_back(table.gameplayDistances[i]);
         }
         
         return distances;
@@ -99,10 +102,10 @@ namespace kx {
     void AdaptiveFarPlaneCalculator::LogFarPlaneUpdate(size_t entityCount, float targetFarPlane, float oldFarPlane) {
         if (entityCount < AdaptiveScaling::MIN_ENTITIES_FOR_PERCENTILE) {
             LOG_DEBUG("[AdaptiveFarPlane] Few objects (%zu), using average: %.1fm (was %.1fm)", 
-                      entityCount, m_currentFarPlane, oldFarPlane);
+                      entityCount, GetCurrentFarPlane(), oldFarPlane);
         } else {
             LOG_DEBUG("[AdaptiveFarPlane] Entities: %zu | %.0fth percentile: %.1fm | Smoothed: %.1fm (was %.1fm)", 
-                      entityCount, AdaptiveScaling::PERCENTILE_THRESHOLD * 100.0f, targetFarPlane, m_currentFarPlane, oldFarPlane);
+                      entityCount, AdaptiveScaling::PERCENTILE_THRESHOLD * 100.0f, targetFarPlane, GetCurrentFarPlane(), oldFarPlane);
         }
     }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <chrono>
 
@@ -23,7 +24,7 @@ namespace kx {
         float UpdateAndGetFarPlane(const PooledFrameRenderData& frameData);
         
         // Get current far plane value
-        float GetCurrentFarPlane() const { return m_currentFarPlane; }
+        float GetCurrentFarPlane() const { return m_currentFarPlane.load(std::memory_order_relaxed); }
         
         // Reset to default value
         void Reset();
@@ -38,7 +39,7 @@ namespace kx {
         void LogFarPlaneUpdate(size_t entityCount, float targetFarPlane, float oldFarPlane);
 
         // State
-        float m_currentFarPlane;
+        std::atomic<float> m_currentFarPlane; // Written by the pipeline worker, read by the GUI
         std::chrono::steady_clock::time_point m_lastRecalc;
     };
 
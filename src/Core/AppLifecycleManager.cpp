@@ -370,6 +370,9 @@ namespace kx {
             // Clear lifecycle manager pointer in D3DRenderHook
             Hooking::D3DRenderHook::SetLifecycleManager(nullptr);
 
+            // Stop the ESP pipeline worker before the game memory it reads can go away
+            ESPRenderer::Shutdown();
+
             // Cleanup hooks and ImGui
             CleanupHooks();
 
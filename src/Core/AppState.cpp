@@ -2,11 +2,18 @@
 #include "SettingsManager.h"
 #include "../Utils/DebugLogger.h"
 
+#include <cstring>
+#include <type_traits>
+
 namespace kx {
 
+    // Edits are detected by comparing bytes, which is only meaningful for plain data
+    static_assert(std::is_trivially_copyable_v<Settings>, "Settings must stay plain data for change detection");
+
     AppState::AppState() {
         // Constructor initializes default values (already done in member initializer list)
         SettingsManager::Load(m_settings); // Load settings from file
+        PublishSettings(true);
     }
 
     AppState& AppState::Get() {
@@ -14,4 +21,30 @@ namespace kx {
         return instance;
     }
 
-} // namespace kx
\ No newline at end of file
+    bool AppState::PublishSettings(bool force) {
+        if (!force && std::memcmp(&m_settings, &m_publishedSettings, sizeof(Settings)) == 0) {
+            return false;
+        }
+        std::memcpy(&m_publishedSettings, &m_settings, sizeof(Settings));
+
+        SettingsSnapshot snapshot;
+        snapshot.settings = std::make_shared<const Settings>(m_settings);
+        snapshot.version = m_settingsVersion.load(std::memory_order_relaxed) + 1;
+
+        std::lock_guard lock(m_mutex);
+        m_settingsSnapshot = std::move(snapshot);
+        m_settingsVersion.store(m_settingsSnapshot.version, std::memory_order_release);
+        return true;
+    }
+
+    void AppState::ReloadSettings() {
+        SettingsManager::Load(m_settings);
+        PublishSettings(true);
+    }
+
+    SettingsSnapshot AppState::GetSettingsSnapshot() const {
+        std::lock_guard lock(m_mutex);
+        return m_settingsSnapshot;
+    }
+
+} // namespace kx
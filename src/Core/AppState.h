@@ -4,6 +4,7 @@
 #include <mutex>
 #include <chrono>
 #include "Settings.h"
+#include "SettingsSnapshot.h"
 #include "AdaptiveFarPlaneCalculator.h"
 
 namespace kx {
@@ -35,9 +36,35 @@ namespace kx {
         AppState& operator=(const AppState&) = delete;
 
         // --- Settings Access ---
+        // The live settings, edited in place by the GUI tabs (render thread only)
         Settings& GetSettings() { return m_settings; }
         const Settings& GetSettings() const { return m_settings; }
 
+        // --- Settings Versioning ---
+        /**
+         * @brief Publish the live settings as a new snapshot if they changed (render thread only)
+         *
+         * Called once per frame after the GUI ran, so every edit of any tab bumps the version.
+         * @param force Publish a new version even if no value differs (e.g. after a reload)
+         * @return True if a new version was published
+         */
+        bool PublishSettings(bool force = false);
+
+        /**
+         * @brief Re-read the settings file into the live settings and publish them (render thread only)
+         */
+        void ReloadSettings();
+
+        /**
+         * @brief The most recently published settings (any thread)
+         */
+        SettingsSnapshot GetSettingsSnapshot() const;
+
+        /**
+         * @brief Monotonic version of the published settings (any thread)
+         */
+        uint64_t GetSettingsVersion() const { return m_settingsVersion.load(std::memory_order_acquire); }
+
         // --- Hook Status Management ---
         HookStatus GetPresentHookStatus() const { return m_presentHookStatus; }
         void SetPresentHookStatus(HookStatus status) { m_presentHookStatus = status; }
@@ -71,6 +98,9 @@ namespace kx {
     private:
         // Application state members
         Settings m_settings;
+        Settings m_publishedSettings;             // Byte copy of the last published values, to detect edits (render thread only)
+        SettingsSnapshot m_settingsSnapshot;      // Guarded by m_mutex
+        std::atomic<uint64_t> m_settingsVersion = 0;
         HookStatus m_presentHookStatus = HookStatus::Unknown;
         #ifdef _DEBUG
         bool m_isVisionWindowOpen = true;   // Debug: Show GUI by default
@@ -83,7 +113,7 @@ namespace kx {
         // Adaptive far plane calculator
         AdaptiveFarPlaneCalculator m_adaptiveFarPlaneCalculator;
 
-        // Mutex for thread-safe access (if needed for future extensions)
+        // Guards the published settings snapshot
         mutable std::mutex m_mutex;
     };
 
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include "Settings.h"
+
+namespace kx {
+
+    /**
+     * @brief An immutable copy of the settings, tagged with the version it was published as
+     *
+     * Snapshots are taken once per update or frame (see AppState::GetSettingsSnapshot) and
+     * handed down through FrameContext, so every stage of that update sees the same values
+     * and none of them races the GUI editing the live settings.
+     */
+    struct SettingsSnapshot {
+        std::shared_ptr<const Settings> settings;
+        uint64_t version = 0; // 0 is never published
+
+        const Settings& Get() const { return *settings; }
+    };
+
+    /**
+     * @brief Tracks which settings version a piece of derived data was built from
+     *
+     * Subsystems that precompute tables from settings keep one next to the table and pass it
+     * every snapshot they are handed; the rebuild callback only runs when the version moved
+     * on, on the caller's own thread, so no locking is needed around the table.
+     */
+    class SettingsObserver {
+    public:
+        /**
+         * @brief Call rebuild(settings) if the snapshot is newer than the last one seen
+         * @return True if rebuild ran
+         */
+        template<typename Rebuild>
+        bool Refresh(const SettingsSnapshot& snapshot, Rebuild&& rebuild) {
+            if (snapshot.version == m_version) {
+                return false;
+            }
+            rebuild(snapshot.Get());
+            m_version = snapshot.version;
+            return true;
+        }
+
+        /**
+         * @brief Force the next Refresh() to rebuild
+         */
+        void Invalidate() { m_version = 0; }
+
+        uint64_t GetVersion() const { return m_version; }
+
+    private:
+        uint64_t m_version = 0;
+    };
+
+} // namespace kx
@@ -1,5 +1,6 @@
 #include "Camera.h"
 #include "MumbleLinkManager.h"
+#include "../Rendering/Utils/FrustumCulling.h"
 
 #include <iostream>
 #include <string>
@@ -12,6 +13,7 @@ namespace kx {
         m_projectionMatrix = glm::mat4(1.0f);
         m_camPos = glm::vec3(0.0f);
         m_playerPosition = glm::vec3(0.0f);
+        UpdateDerivedMatrices();
     }
 
     Camera::~Camera() {
@@ -95,6 +97,13 @@ namespace kx {
         m_projectionMatrix[2][2] = zFar / (zFar - zNear);
         m_projectionMatrix[2][3] = 1.0f;
         m_projectionMatrix[3][2] = -(zFar * zNear) / (zFar - zNear);
+
+        UpdateDerivedMatrices();
+    }
+
+    void Camera::UpdateDerivedMatrices() {
+        m_viewProjectionMatrix = m_projectionMatrix * m_viewMatrix;
+        m_frustumPlanes = FrustumCulling::ExtractPlanes(m_viewProjectionMatrix);
     }
 
 } // namespace kx
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include "glm.hpp"
 #include "MumbleLink.h" // For the struct in the Update method parameter
 #include "gtc/matrix_transform.hpp"
@@ -17,12 +18,26 @@ namespace kx {
 
         const glm::mat4& GetViewMatrix() const { return m_viewMatrix; }
         const glm::mat4& GetProjectionMatrix() const { return m_projectionMatrix; }
+        const glm::mat4& GetViewProjectionMatrix() const { return m_viewProjectionMatrix; }
+
+        /**
+         * @brief Frustum planes (left, right, bottom, top, near, far) as (normal, distance)
+         *
+         * Normals point into the frustum and are unit length, so dot(normal, p) + distance
+         * is the signed distance of p from the plane; a point is inside when it is >= 0 for all six.
+         */
+        const std::array<glm::vec4, 6>& GetFrustumPlanes() const { return m_frustumPlanes; }
         const glm::vec3& GetCameraPosition() const { return m_camPos; }
         const glm::vec3& GetPlayerPosition() const { return m_playerPosition; }
 
     private:
+        // Recompute everything derived from the view and projection matrices
+        void UpdateDerivedMatrices();
+
         glm::mat4 m_viewMatrix;
         glm::mat4 m_projectionMatrix;
+        glm::mat4 m_viewProjectionMatrix;          // projection * view, once per update instead of per projected point
+        std::array<glm::vec4, 6> m_frustumPlanes;
         glm::vec3 m_camPos;
         glm::vec3 m_playerPosition;
     };
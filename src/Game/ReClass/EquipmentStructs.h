@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include "../../Utils/SafeForeignClass.h"
 #include "../offsets.h"
 #include "ItemStructs.h"
@@ -11,6 +12,10 @@ namespace kx {
         // The total number of equipment slots in the game's data structure.
         constexpr int NUM_EQUIPMENT_SLOTS = 69;
 
+        // Leading part of the equipment array that covers every combat gear slot (up to OffhandWeapon2).
+        constexpr int NUM_COMBAT_EQUIPMENT_SLOTS = 33;
+        using EquipSlotTable = std::array<void*, NUM_COMBAT_EQUIPMENT_SLOTS>;
+
         /**
          * @brief Wrapper for a single equipment slot.
          * Contains pointers to the item definition, stats, upgrades, etc.
@@ -56,6 +61,17 @@ namespace kx {
 
                 return EquipSlot(slotPtr);
             }
+
+            /**
+             * @brief Read the combat gear part of the equipment array in a single guarded read.
+             * Entries are raw EquipSlot pointers and still need validation before use.
+             */
+            bool ReadEquipSlotTable(EquipSlotTable& outTable) const {
+                if (!data()) {
+                    return false;
+                }
+                return kx::Debug::SafeRead<EquipSlotTable>(data(), Offsets::Inventory::EQUIPMENT_ARRAY, outTable);
+            }
         };
 
     } // namespace ReClass
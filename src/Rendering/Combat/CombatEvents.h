@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include "../../Utils/SpscRing.h"
+
+namespace kx
+{
+	namespace CombatEventConfig {
+		constexpr size_t STREAM_CAPACITY = 4096; // Must be a power of two; a busy update publishes a few hundred
+	}
+
+	enum class CombatEventType : uint8_t {
+		Damage,         // amount = health lost
+		Heal,           // amount = health restored
+		BarrierChange,  // amount = new barrier minus old barrier
+		Death,          // amount = 0
+		Respawn         // amount = health after the reset
+	};
+
+	/**
+	 * @brief One health/barrier transition detected by the CombatStateManager
+	 */
+	struct CombatEvent
+	{
+		uint64_t timestamp = 0;
+		const void* entity = nullptr; // Entity address, for identification only
+		uint32_t slot = 0;            // CombatStateManager slot the entity held when the event was published
+		CombatEventType type = CombatEventType::Damage;
+		float amount = 0.0f;
+	};
+
+	using CombatEventStream = SpscRing<CombatEvent, CombatEventConfig::STREAM_CAPACITY>;
+} // namespace kx
@@ -1,6 +1,5 @@
 #pragma once
 #include <cstdint>
-#include <deque>
 #include <glm/vec3.hpp>
 
 namespace kx
@@ -43,8 +42,16 @@ namespace kx
         // Max health tracking for state change detection
         float lastKnownMaxHealth = 0.0f;
 
-		// Movement trail history
-		std::deque<PositionHistoryPoint> positionHistory;
+		// Pending timer in the CombatStateManager's timing wheel (0 if none), and whether it has fired
+		uint64_t nextTimerAt = 0;
+		bool timerDue = false;
+
+		// Movement trail history, a handle into the CombatStateManager's TrailHistoryStore
+		// (UINT32_MAX for entities that can't draw a trail)
+		uint32_t trail = UINT32_MAX;
+
+		// Rolling damage history in the CombatStateManager's DpsWindowStore (UINT32_MAX until first damaged)
+		uint32_t dpsHistory = UINT32_MAX;
 
 		// Utility helpers (optional future use)
 		bool IsDead() const { return deathTimestamp != 0; }
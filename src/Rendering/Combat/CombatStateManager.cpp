@@ -1,6 +1,5 @@
 #include "CombatStateManager.h"
 #include "../Utils/ESPConstants.h"
-#include "../../Core/AppState.h"
 #include <algorithm>
 #include <glm/geometric.hpp>
 
@@ -10,21 +9,108 @@ namespace kx
 		constexpr float MIN_POSITION_CHANGE = 0.1f;
 	}
 
-	EntityCombatState& CombatStateManager::AcquireState(const RenderableEntity* entity)
+	uint32_t CombatStateManager::AcquireSlot(const RenderableEntity* entity)
 	{
-		return m_entityStates[entity->address]; // creates if missing
+		auto [it, inserted] = m_slotIndex.try_emplace(entity->address, NO_SLOT);
+		if (inserted)
+		{
+			it->second = AllocateSlot(entity->address);
+		}
+		MarkSeen(it->second);
+		return it->second;
+	}
+
+	uint32_t CombatStateManager::AllocateSlot(const void* owner)
+	{
+		uint32_t slot = m_freeSlot;
+		if (slot != NO_SLOT)
+		{
+			m_freeSlot = m_links[slot].next;
+			m_states[slot] = {};
+		}
+		else
+		{
+			slot = static_cast<uint32_t>(m_states.size());
+			m_states.emplace_back();
+			m_links.emplace_back();
+		}
+
+		m_links[slot] = SlotLink{ owner, m_generation, m_newestSlot, NO_SLOT };
+		if (m_newestSlot != NO_SLOT) m_links[m_newestSlot].next = slot;
+		else m_oldestSlot = slot;
+		m_newestSlot = slot;
+		return slot;
+	}
+
+	void CombatStateManager::FreeSlot(uint32_t slot)
+	{
+		ReleaseTrail(m_states[slot]);
+		ReleaseDpsHistory(m_states[slot]);
+		Unlink(slot);
+		m_slotIndex.erase(m_links[slot].owner);
+		m_links[slot] = SlotLink{ nullptr, 0, NO_SLOT, m_freeSlot };
+		m_freeSlot = slot;
+	}
+
+	void CombatStateManager::Unlink(uint32_t slot)
+	{
+		SlotLink& link = m_links[slot];
+		if (link.prev != NO_SLOT) m_links[link.prev].next = link.next;
+		else m_oldestSlot = link.next;
+		if (link.next != NO_SLOT) m_links[link.next].prev = link.prev;
+		else m_newestSlot = link.prev;
+		link.prev = link.next = NO_SLOT;
+	}
+
+	void CombatStateManager::MarkSeen(uint32_t slot)
+	{
+		SlotLink& link = m_links[slot];
+		if (link.generation == m_generation && slot == m_newestSlot)
+		{
+			return;
+		}
+
+		// Move to the back, behind everything seen earlier in this or previous updates
+		link.generation = m_generation;
+		if (slot != m_newestSlot)
+		{
+			Unlink(slot);
+			link.prev = m_newestSlot;
+			m_links[m_newestSlot].next = slot;
+			m_newestSlot = slot;
+		}
 	}
 
-	void CombatStateManager::Update(const std::vector<RenderableEntity*>& entities, uint64_t now)
+	void CombatStateManager::Update(const std::vector<RenderableEntity*>& entities, const TrailSettings& trailSettings, uint64_t now)
 	{
+		++m_generation;
+
+		m_trailsEnabled = trailSettings.enabled;
+		m_trailsHostileOnly = trailSettings.displayMode == TrailDisplayMode::Hostile;
+		m_trails.SetCapacity(static_cast<uint32_t>(std::max(trailSettings.maxPoints, 1)));
+
+		m_updateStats = {};
+		m_timers.Advance(now, [this](uint32_t slot, uint64_t deadline) { OnTimerFired(slot, deadline); });
+
 		for (auto* entity : entities)
 		{
-			if (!entity || !entity->isValid || entity->maxHealth <= 0.0f)
+			if (!entity)
 			{
 				continue;
 			}
+			if (!entity->isValid || entity->maxHealth <= 0.0f)
+			{
+				// Still extracted, so keep any state it already has alive
+				if (auto it = m_slotIndex.find(entity->address); it != m_slotIndex.end())
+				{
+					MarkSeen(it->second);
+				}
+				continue;
+			}
 			ProcessEntity(entity, now);
 		}
+
+		ConsumeEvents();
 	}
 
 	void CombatStateManager::UpdateDamageAccumulatorAnimation(EntityCombatState& state, uint64_t now)
@@ -79,6 +165,7 @@ namespace kx
 		const float currentBarrier = entity->currentBarrier;
 		if (currentBarrier != state.lastKnownBarrier)
 		{
+			Publish(state, CombatEventType::BarrierChange, currentBarrier - state.lastKnownBarrier, now);
 			state.barrierOnLastChange = state.lastKnownBarrier;
 			state.lastBarrierChangeTimestamp = now;
 		}
@@ -139,10 +226,21 @@ namespace kx
 
 	void CombatStateManager::ProcessEntity(RenderableEntity* entity, uint64_t now)
 	{
-		EntityCombatState& state = AcquireState(entity);
+		const uint32_t slot = AcquireSlot(entity);
+		EntityCombatState& state = m_states[slot];
 		const float currentHealth = entity->currentHealth;
 		const float currentMaxHealth = entity->maxHealth;
 
+		// Nothing changed and no timer due: the full pass below would leave the state as it is
+		if (IsIdle(state, entity))
+		{
+			++m_updateStats.idle;
+			UpdatePositionHistory(state, entity, now);
+			return;
+		}
+		++m_updateStats.processed;
+		state.timerDue = false;
+
 		UpdateDamageAccumulatorAnimation(state, now);
 		
 		if (DetectStateChangeOrRespawn(entity, state, now)) {
@@ -161,6 +259,70 @@ namespace kx
 		state.lastKnownMaxHealth = currentMaxHealth;
 		state.lastKnownBarrier = entity->currentBarrier;
 		state.lastSeenTimestamp = now;
+
+		ScheduleNextTimer(slot, state);
+	}
+
+	bool CombatStateManager::IsIdle(const EntityCombatState& state, const RenderableEntity* entity)
+	{
+		return state.lastSeenTimestamp > 0 && !state.timerDue &&
+		       entity->currentHealth == state.lastKnownHealth &&
+		       entity->maxHealth == state.lastKnownMaxHealth &&
+		       entity->currentBarrier == state.lastKnownBarrier;
+	}
+
+	uint64_t CombatStateManager::NextTimerDeadline(const EntityCombatState& state)
+	{
+		// The first moment each check in UpdateDamageAccumulatorAnimation / TriggerDamageFlushIfNeeded passes
+		if (state.flushAnimationStartTime > 0)
+		{
+			return state.flushAnimationStartTime + CombatEffects::DAMAGE_ACCUMULATOR_FADE_MS;
+		}
+		if (state.accumulatedDamage <= 0.0f)
+		{
+			return 0;
+		}
+		if (state.deathTimestamp > 0)
+		{
+			return state.lastHitTimestamp + CombatEffects::POST_MORTEM_FLUSH_DELAY_MS + 1;
+		}
+
+		uint64_t deadline = state.lastHitTimestamp + CombatEffects::BURST_INACTIVITY_TIMEOUT_MS + 1;
+		if (state.burstStartTime > 0)
+		{
+			deadline = std::min(deadline, state.burstStartTime + CombatEffects::MAX_BURST_DURATION_MS + 1);
+		}
+		return deadline;
+	}
+
+	void CombatStateManager::ScheduleNextTimer(uint32_t slot, EntityCombatState& state)
+	{
+		const uint64_t deadline = NextTimerDeadline(state);
+		if (deadline != state.nextTimerAt)
+		{
+			// Any earlier timer stays in the wheel and is ignored when it fires
+			state.nextTimerAt = deadline;
+			if (deadline != 0)
+			{
+				m_timers.Schedule(slot, deadline);
+			}
+		}
+	}
+
+	void CombatStateManager::OnTimerFired(uint32_t slot, uint64_t deadline)
+	{
+		if (m_links[slot].owner == nullptr)
+		{
+			return; // Pruned since
+		}
+
+		EntityCombatState& state = m_states[slot];
+		if (state.nextTimerAt == deadline)
+		{
+			state.nextTimerAt = 0;
+			state.timerDue = true;
+			++m_updateStats.timersFired;
+		}
 	}
 
 	void CombatStateManager::HandleDamage(EntityCombatState& state,
@@ -181,10 +343,12 @@ namespace kx
 	
 		state.lastDamageTaken = damage;
 		state.lastHitTimestamp = now;
+		Publish(state, CombatEventType::Damage, damage, now);
 	
 		if (currentHealth <= 0.0f && state.deathTimestamp == 0)
 		{
 			state.deathTimestamp = now;
+			Publish(state, CombatEventType::Death, 0.0f, now);
 		}
 	}
 
@@ -208,6 +372,7 @@ namespace kx
 
 		state.lastHealTimestamp = now;
 		state.lastHealFlashTimestamp = now;
+		Publish(state, CombatEventType::Heal, currentHealth - state.lastKnownHealth, now);
 
 		// If entity was previously flagged dead but now > 0, ensure deathTimestamp stays (for fade) or reset?
 		// Current behavior: we keep deathTimestamp until respawn detection resets it via ResetForRespawn().
@@ -221,7 +386,12 @@ namespace kx
 		// Preserve current barrier state to prevent phantom barrier change detection
 		const float currentBarrier = state.lastKnownBarrier;
 		
+		// The damage history is released by the Respawn event's consumer, after the damage before it
+		const uint32_t dpsHistory = state.dpsHistory;
+		ReleaseTrail(state);
 		state = {};
+		state.dpsHistory = dpsHistory;
+		Publish(state, CombatEventType::Respawn, currentHealth, now);
 		state.lastKnownHealth = currentHealth;
 		state.lastKnownBarrier = currentBarrier; // Preserve barrier state
 		state.lastSeenTimestamp = now;
@@ -230,25 +400,158 @@ namespace kx
 
 	const EntityCombatState* CombatStateManager::GetState(const void* entityId) const
 	{
-		auto it = m_entityStates.find(entityId);
-		return (it != m_entityStates.end()) ? &it->second : nullptr;
+		auto it = m_slotIndex.find(entityId);
+		return (it != m_slotIndex.end()) ? &m_states[it->second] : nullptr;
 	}
 
 	EntityCombatState* CombatStateManager::GetStateNonConst(const void* entityId)
 	{
-		auto it = m_entityStates.find(entityId);
-		return (it != m_entityStates.end()) ? &it->second : nullptr;
+		auto it = m_slotIndex.find(entityId);
+		return (it != m_slotIndex.end()) ? &m_states[it->second] : nullptr;
+	}
+
+	bool CombatStateManager::IsTrailEligible(const RenderableEntity* entity) const
+	{
+		// Mirrors the checks in ESPTrailRenderer::RenderPlayerTrail
+		if (!m_trailsEnabled || entity->entityType != ESPEntityType::Player)
+		{
+			return false;
+		}
+		return !m_trailsHostileOnly ||
+		       static_cast<const RenderablePlayer*>(entity)->attitude == Game::Attitude::Hostile;
+	}
+
+	void CombatStateManager::ReleaseTrail(EntityCombatState& state)
+	{
+		if (state.trail != TrailHistoryStore::NO_TRAIL)
+		{
+			m_trails.Release(state.trail);
+			state.trail = TrailHistoryStore::NO_TRAIL;
+		}
+	}
+
+	uint32_t CombatStateManager::SlotOf(const EntityCombatState& state) const
+	{
+		return static_cast<uint32_t>(&state - m_states.data());
+	}
+
+	void CombatStateManager::Publish(const EntityCombatState& state, CombatEventType type, float amount, uint64_t now)
+	{
+		if (!m_rollingDpsEnabled)
+		{
+			return;
+		}
+
+		CombatEvent event;
+		event.timestamp = now;
+		event.slot = SlotOf(state);
+		event.entity = m_links[event.slot].owner;
+		event.type = type;
+		event.amount = amount;
+
+		if (m_events.TryPush(event))
+		{
+			++m_updateStats.events;
+		}
+		else
+		{
+			++m_updateStats.droppedEvents;
+		}
+	}
+
+	void CombatStateManager::ConsumeEvents()
+	{
+		// Slots can't have been freed yet: Prune() only runs between updates
+		CombatEvent event;
+		while (m_events.TryPop(event))
+		{
+			EntityCombatState& state = m_states[event.slot];
+			switch (event.type)
+			{
+			case CombatEventType::Damage:
+				if (state.dpsHistory == DpsWindowStore::NO_HISTORY)
+				{
+					state.dpsHistory = m_dpsWindows.Acquire();
+				}
+				m_dpsWindows.AddDamage(state.dpsHistory, event.timestamp, event.amount);
+				break;
+			case CombatEventType::Respawn:
+				ReleaseDpsHistory(state);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	void CombatStateManager::ReleaseDpsHistory(EntityCombatState& state)
+	{
+		if (state.dpsHistory != DpsWindowStore::NO_HISTORY)
+		{
+			m_dpsWindows.Release(state.dpsHistory);
+			state.dpsHistory = DpsWindowStore::NO_HISTORY;
+		}
+	}
+
+	void CombatStateManager::SetRollingDpsEnabled(bool enabled)
+	{
+		if (m_rollingDpsEnabled && !enabled)
+		{
+			// Free slots hold no history, so every live one is released here
+			for (EntityCombatState& state : m_states)
+			{
+				ReleaseDpsHistory(state);
+			}
+		}
+		m_rollingDpsEnabled = enabled;
+	}
+
+	float CombatStateManager::GetDps(const void* entityId, uint64_t now, DpsWindow window) const
+	{
+		const EntityCombatState* state = GetState(entityId);
+		if (!state || state->dpsHistory == DpsWindowStore::NO_HISTORY)
+		{
+			return 0.0f;
+		}
+		return m_dpsWindows.GetDps(state->dpsHistory, now, window);
+	}
+
+	float CombatStateManager::GetBurstDps(const void* entityId, uint64_t now) const
+	{
+		const EntityCombatState* state = GetState(entityId);
+		if (!state || state->burstStartTime == 0 || state->accumulatedDamage <= 0.0f || now <= state->burstStartTime)
+		{
+			return 0.0f;
+		}
+
+		const uint64_t durationMs = now - state->burstStartTime;
+		if (durationMs <= 100)
+		{
+			return 0.0f; // Too short to give a meaningful rate
+		}
+
+		// accumulatedDamage is exactly the damage taken since burstStartTime
+		return static_cast<float>(static_cast<double>(state->accumulatedDamage) * 1000.0 / static_cast<double>(durationMs));
 	}
 
 	void CombatStateManager::UpdatePositionHistory(EntityCombatState& state, const RenderableEntity* entity, uint64_t now)
 	{
-		const auto& settings = AppState::Get().GetSettings();
-		const size_t MAX_HISTORY_POINTS = static_cast<size_t>(settings.playerESP.trails.maxPoints);
-		
-		bool shouldRecordPosition = state.positionHistory.empty();
+		if (!IsTrailEligible(entity))
+		{
+			// Trails got disabled, or this player can't show one (any more)
+			ReleaseTrail(state);
+			return;
+		}
+
+		if (state.trail == TrailHistoryStore::NO_TRAIL)
+		{
+			state.trail = m_trails.Acquire();
+		}
+
+		const PositionHistoryPoint* lastPoint = m_trails.Newest(state.trail);
+		bool shouldRecordPosition = (lastPoint == nullptr);
 		if (!shouldRecordPosition) {
-			const glm::vec3& lastPos = state.positionHistory.back().position;
-			float distanceMoved = glm::distance(entity->position, lastPos);
+			float distanceMoved = glm::distance(entity->position, lastPoint->position);
 			shouldRecordPosition = (distanceMoved >= MIN_POSITION_CHANGE);
 		}
 		
@@ -256,24 +559,16 @@ namespace kx
 			PositionHistoryPoint newPoint;
 			newPoint.position = entity->position;
 			newPoint.timestamp = now;
-			state.positionHistory.push_back(newPoint);
-			
-			if (state.positionHistory.size() > MAX_HISTORY_POINTS) {
-				state.positionHistory.pop_front();
-			}
+			m_trails.Push(state.trail, newPoint);
 		}
 	}
 
-	void CombatStateManager::Prune(const std::unordered_set<const void*>& activeEntities)
+	void CombatStateManager::Prune()
 	{
-		for (auto it = m_entityStates.begin(); it != m_entityStates.end();)
+		// Everything seen by the last Update() sits behind the stale slots, so stop at the first one
+		while (m_oldestSlot != NO_SLOT && m_links[m_oldestSlot].generation != m_generation)
 		{
-			// If the entity address is NOT in the active list, it's truly gone.
-			if (activeEntities.find(it->first) == activeEntities.end()) {
-				it = m_entityStates.erase(it);
-			} else {
-				++it;
-			}
+			FreeSlot(m_oldestSlot);
 		}
 	}
 } // namespace kx
@@ -1,13 +1,30 @@
 #pragma once
 
-#include <unordered_map>
-#include <unordered_set>
+#include <cstdint>
 #include <vector>
+#include <ankerl/unordered_dense.h>
+#include "CombatEvents.h"
 #include "CombatState.h"
+#include "DpsWindowStore.h"
+#include "TrailHistoryStore.h"
+#include "../../Core/Settings/ESPSettings.h"
+#include "../../Utils/TimingWheel.h"
 #include "../Data/RenderableData.h" // For RenderableEntity
 
 namespace kx
 {
+	/**
+	 * @brief How much work the last CombatStateManager::Update() did
+	 */
+	struct CombatStateUpdateStats
+	{
+		uint32_t processed = 0;     // Entities that went through the full pass
+		uint32_t idle = 0;          // Entities skipped after the change-detection compare
+		uint32_t timersFired = 0;   // Damage flush / fade timers that came due
+		uint32_t events = 0;        // Combat events published
+		uint32_t droppedEvents = 0; // Events lost because the stream was full
+	};
+
 	/**
 	 * @brief Tracks transient combat-related state (damage, healing, death, respawn) for render effects.
 	 *
@@ -15,7 +32,26 @@ namespace kx
 	 *  - Detect damage bursts & accumulate them for "pending damage" overlays.
 	 *  - Detect heals and provide timing for overlay/flash effects.
 	 *  - Detect death & respawn transitions.
-	 *  - Cleanup inactive entity states after a timeout.
+	 *  - Drop the state of entities that are no longer extracted.
+	 *
+	 * Storage: states live in a dense slot array indexed through a flat address -> slot map.
+	 * Every Update() stamps a new generation on the slots it sees and moves them to the back
+	 * of an intrusive recency list, so the slots of vanished entities collect at the front
+	 * and Prune() only visits those - no per-update set of active addresses is built.
+	 * Freed slots are reused, so steady-state updates allocate nothing.
+	 * Position history is only recorded for entities the trail settings could render (see
+	 * TrailHistoryStore); everything else skips it entirely.
+	 *
+	 * Timers: the CombatEffects timeouts (burst inactivity, max burst duration, post-mortem
+	 * flush, accumulator fade) are filed in a TimingWheel. An entity whose health, max health
+	 * and barrier are unchanged and that has no timer due is left alone, so entities out of
+	 * combat cost one compare per update.
+	 *
+	 * Events: while rolling DPS is enabled (SetRollingDpsEnabled), every damage, heal, barrier
+	 * change, death and respawn is published as a CombatEvent to a single-producer ring. The
+	 * end of Update() consumes it into per-entity rolling damage windows (DpsWindowStore),
+	 * which answer 1s/5s/30s DPS queries in O(1). No overlay element shows those windows, so
+	 * they are off by default; the burst DPS display reads the burst accumulator instead.
 	 *
 	 * Thread-safety: NOT thread-safe. All methods are expected to be called from the render/game thread.
 	 */
@@ -24,16 +60,50 @@ namespace kx
 	public:
 		/**
 		 * @brief Update/refresh state for a set of entities.
-		 * @param entities Entities currently visible/processed this frame.
+		 * @param entities Every entity extracted this update; their states are kept alive by the next Prune().
+		 * @param trailSettings Trail settings from the update's settings snapshot; decide who records position history.
 		 * @param now Current timestamp in milliseconds (use GetTickCount64 or equivalent).
 		 */
-		void Update(const std::vector<RenderableEntity*>& entities, uint64_t now);
+		void Update(const std::vector<RenderableEntity*>& entities, const TrailSettings& trailSettings, uint64_t now);
 
 		/**
-		 * @brief Remove combat state for entities that are no longer present in the game.
-		 * @param activeEntities Set of entity addresses that are currently active in the game.
+		 * @brief Remove combat state for entities that were not part of the last Update().
+		 * Cost is proportional to the number of states removed.
 		 */
-		void Prune(const std::unordered_set<const void*>& activeEntities);
+		void Prune();
+
+		/**
+		 * @brief Number of entities with stored combat state.
+		 */
+		size_t GetStateCount() const { return m_slotIndex.size(); }
+
+		/**
+		 * @brief Position history of every entity that records a trail (see EntityCombatState::trail).
+		 */
+		const TrailHistoryStore& GetTrailHistory() const { return m_trails; }
+
+		const CombatStateUpdateStats& GetLastUpdateStats() const { return m_updateStats; }
+
+		/**
+		 * @brief Publish combat events and keep the rolling damage windows GetDps() reads (off by default).
+		 * Disabling drops every window kept so far.
+		 */
+		void SetRollingDpsEnabled(bool enabled);
+		bool IsRollingDpsEnabled() const { return m_rollingDpsEnabled; }
+
+		/**
+		 * @brief Damage per second an entity took over a rolling window ending at now.
+		 * 0 if the entity was never damaged while rolling DPS was enabled.
+		 */
+		float GetDps(const void* entityId, uint64_t now, DpsWindow window) const;
+
+		/**
+		 * @brief DPS over the current damage burst, for the burst DPS display (0 outside a burst).
+		 *
+		 * The burst's own accumulated damage divided by its duration. The rolling windows can't
+		 * serve this: their 250ms buckets would mix in hits from before the burst started.
+		 */
+		float GetBurstDps(const void* entityId, uint64_t now) const;
 
 		/**
 		 * @brief Get immutable pointer to stored entity combat state (nullptr if missing).
@@ -41,14 +111,56 @@ namespace kx
 		const EntityCombatState* GetState(const void* entityId) const;
 
 	private:
-		EntityCombatState* GetStateNonConst(const void* entityId); // This can be made private now
-		std::unordered_map<const void*, EntityCombatState> m_entityStates;
+		static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+		/**
+		 * @brief Bookkeeping for one slot of m_states
+		 */
+		struct SlotLink
+		{
+			const void* owner = nullptr;  // Entity address, nullptr while the slot is free
+			uint64_t generation = 0;      // Last Update() that saw the owner
+			uint32_t prev = NO_SLOT;      // Recency list (live slots) or free list (next only)
+			uint32_t next = NO_SLOT;
+		};
+
+		EntityCombatState* GetStateNonConst(const void* entityId);
+
+		ankerl::unordered_dense::map<const void*, uint32_t> m_slotIndex;
+		std::vector<EntityCombatState> m_states;
+		std::vector<SlotLink> m_links;
+		uint32_t m_oldestSlot = NO_SLOT;  // Front of the recency list - least recently seen
+		uint32_t m_newestSlot = NO_SLOT;
+		uint32_t m_freeSlot = NO_SLOT;
+		uint64_t m_generation = 0;
+
+		TrailHistoryStore m_trails;
+		bool m_trailsEnabled = false;     // Trail settings, captured once per Update()
+		bool m_trailsHostileOnly = true;
+
+		TimingWheel m_timers;             // Ids are slot indices
+		CombatEventStream m_events;
+		DpsWindowStore m_dpsWindows;
+		bool m_rollingDpsEnabled = false; // The windows are the stream's only consumer
+		CombatStateUpdateStats m_updateStats;
 
 		// --- Internal helpers (all assume non-null entity & validity already checked) ---
 
-		EntityCombatState& AcquireState(const RenderableEntity* entity);
+		uint32_t AcquireSlot(const RenderableEntity* entity);
+		uint32_t AllocateSlot(const void* owner);
+		void FreeSlot(uint32_t slot);
+		void MarkSeen(uint32_t slot);
+		void Unlink(uint32_t slot);
 
 		void ProcessEntity(RenderableEntity* entity, uint64_t now);
+		static bool IsIdle(const EntityCombatState& state, const RenderableEntity* entity);
+		static uint64_t NextTimerDeadline(const EntityCombatState& state);
+		void ScheduleNextTimer(uint32_t slot, EntityCombatState& state);
+		void OnTimerFired(uint32_t slot, uint64_t deadline);
+		uint32_t SlotOf(const EntityCombatState& state) const;
+		void Publish(const EntityCombatState& state, CombatEventType type, float amount, uint64_t now);
+		void ConsumeEvents();
+		void ReleaseDpsHistory(EntityCombatState& state);
 		void HandleDamage(EntityCombatState& state,
 		                  const RenderableEntity* entity,
 		                  float currentHealth,
@@ -57,6 +169,8 @@ namespace kx
 		                   const RenderableEntity* entity,
 		                   float currentHealth,
 		                   uint64_t now);
+		bool IsTrailEligible(const RenderableEntity* entity) const;
+		void ReleaseTrail(EntityCombatState& state);
 		void ResetForRespawn(EntityCombatState& state,
 		                     float currentHealth,
 		                     uint64_t now);
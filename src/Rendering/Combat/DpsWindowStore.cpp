@@ -0,0 +1,79 @@
+#include "DpsWindowStore.h"
+#include <algorithm>
+
+namespace kx
+{
+	namespace {
+		constexpr uint64_t BUCKET_MASK = DpsWindowConfig::HISTORY_BUCKETS - 1;
+
+		static_assert(DpsWindowStore::GetWindowMs(DpsWindow::ThirtySeconds) / DpsWindowConfig::BUCKET_MS < DpsWindowConfig::HISTORY_BUCKETS,
+		              "The longest window must fit in the history ring");
+	}
+
+	uint32_t DpsWindowStore::Acquire()
+	{
+		uint32_t history = m_freeHistory;
+		if (history != NO_HISTORY)
+		{
+			m_freeHistory = m_histories[history].nextFree;
+			m_histories[history] = History{};
+		}
+		else
+		{
+			history = static_cast<uint32_t>(m_histories.size());
+			m_histories.emplace_back();
+		}
+
+		++m_activeCount;
+		return history;
+	}
+
+	void DpsWindowStore::Release(uint32_t history)
+	{
+		m_histories[history].nextFree = m_freeHistory;
+		m_freeHistory = history;
+		--m_activeCount;
+	}
+
+	void DpsWindowStore::AddDamage(uint32_t history, uint64_t timestamp, float amount)
+	{
+		History& h = m_histories[history];
+		const uint64_t bucket = timestamp / DpsWindowConfig::BUCKET_MS;
+		if (bucket > h.bucket)
+		{
+			// Buckets without hits carry the running total forward
+			const uint64_t firstSkipped = std::max(h.bucket + 1, bucket - std::min<uint64_t>(bucket, BUCKET_MASK));
+			for (uint64_t b = firstSkipped; b < bucket; ++b)
+			{
+				h.totals[b & BUCKET_MASK] = h.total;
+			}
+			h.bucket = bucket;
+		}
+
+		h.total += amount;
+		h.totals[h.bucket & BUCKET_MASK] = h.total;
+	}
+
+	double DpsWindowStore::GetDamage(uint32_t history, uint64_t now, DpsWindow window) const
+	{
+		const History& h = m_histories[history];
+		const uint64_t nowBucket = now / DpsWindowConfig::BUCKET_MS;
+		const uint64_t windowBuckets = GetWindowMs(window) / DpsWindowConfig::BUCKET_MS;
+
+		// Running total at the end of a bucket; anything newer than the last hit is the current total
+		auto totalAt = [&h](uint64_t bucket) {
+			if (bucket >= h.bucket) return h.total;
+			const uint64_t age = std::min<uint64_t>(h.bucket - bucket, BUCKET_MASK);
+			return h.totals[(h.bucket - age) & BUCKET_MASK];
+		};
+
+		const uint64_t windowStart = nowBucket >= windowBuckets ? nowBucket - windowBuckets : 0;
+		return std::max(0.0, totalAt(nowBucket) - totalAt(windowStart));
+	}
+
+	float DpsWindowStore::GetDps(uint32_t history, uint64_t now, DpsWindow window) const
+	{
+		const double seconds = static_cast<double>(GetWindowMs(window)) / 1000.0;
+		return static_cast<float>(GetDamage(history, now, window) / seconds);
+	}
+} // namespace kx
@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace kx
+{
+	namespace DpsWindowConfig {
+		constexpr uint64_t BUCKET_MS = 250;
+		constexpr uint32_t HISTORY_BUCKETS = 128; // Power of two, longer than the longest window
+
+		static_assert((HISTORY_BUCKETS & (HISTORY_BUCKETS - 1)) == 0, "HISTORY_BUCKETS must be a power of two");
+	}
+
+	/**
+	 * @brief Rolling windows damage is summed over
+	 */
+	enum class DpsWindow : uint8_t {
+		OneSecond,
+		FiveSeconds,
+		ThirtySeconds
+	};
+
+	/**
+	 * @brief Pooled per-entity damage histories answering rolling DPS queries in O(1)
+	 *
+	 * Each history is a ring of HISTORY_BUCKETS 250ms buckets holding the running damage
+	 * total at the end of each bucket, so the damage inside any window is the current total
+	 * minus the total at the bucket the window starts after. Recording fills the buckets
+	 * skipped since the last hit (at most one ring's worth); queries never loop.
+	 *
+	 * Histories are handed out only to entities that take damage and recycled on a free
+	 * list, like TrailHistoryStore.
+	 *
+	 * Thread-safety: NOT thread-safe. Owned by the CombatStateManager.
+	 */
+	class DpsWindowStore
+	{
+	public:
+		static constexpr uint32_t NO_HISTORY = UINT32_MAX;
+
+		static constexpr uint64_t GetWindowMs(DpsWindow window)
+		{
+			switch (window) {
+			case DpsWindow::OneSecond: return 1000;
+			case DpsWindow::FiveSeconds: return 5000;
+			case DpsWindow::ThirtySeconds: return 30000;
+			}
+			return 0;
+		}
+
+		uint32_t Acquire();
+		void Release(uint32_t history);
+
+		/**
+		 * @brief Record damage at a timestamp; hits older than the newest recorded bucket count towards it
+		 */
+		void AddDamage(uint32_t history, uint64_t timestamp, float amount);
+
+		/**
+		 * @brief Damage recorded in the window ending at now
+		 */
+		double GetDamage(uint32_t history, uint64_t now, DpsWindow window) const;
+
+		/**
+		 * @brief Damage in the window ending at now, per second of the window
+		 */
+		float GetDps(uint32_t history, uint64_t now, DpsWindow window) const;
+
+		size_t GetActiveCount() const { return m_activeCount; }
+
+	private:
+		struct History
+		{
+			std::array<double, DpsWindowConfig::HISTORY_BUCKETS> totals{}; // Running total at the end of each bucket
+			double total = 0.0;
+			uint64_t bucket = 0;       // Newest bucket recorded
+			uint32_t nextFree = NO_HISTORY;
+		};
+
+		std::vector<History> m_histories;
+		uint32_t m_freeHistory = NO_HISTORY;
+		size_t m_activeCount = 0;
+	};
+} // namespace kx
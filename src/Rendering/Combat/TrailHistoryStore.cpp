@@ -0,0 +1,96 @@
+#include "TrailHistoryStore.h"
+#include <algorithm>
+
+namespace kx
+{
+	void TrailHistoryStore::SetCapacity(uint32_t pointsPerTrail)
+	{
+		pointsPerTrail = std::max<uint32_t>(pointsPerTrail, 1);
+		if (pointsPerTrail == m_capacity)
+		{
+			return;
+		}
+
+		// Re-lay every ring at the new stride, unrolled so its oldest kept point comes first
+		std::vector<PositionHistoryPoint> points(m_rings.size() * static_cast<size_t>(pointsPerTrail));
+		for (uint32_t trail = 0; trail < m_rings.size(); ++trail)
+		{
+			Ring& ring = m_rings[trail];
+			const uint32_t kept = std::min(ring.count, pointsPerTrail);
+			const uint32_t skipped = ring.count - kept;
+			PositionHistoryPoint* destination = points.data() + static_cast<size_t>(trail) * pointsPerTrail;
+			for (uint32_t i = 0; i < kept; ++i)
+			{
+				destination[i] = RingBegin(trail)[(ring.head + skipped + i) % m_capacity];
+			}
+			ring.head = 0;
+			ring.count = kept;
+		}
+
+		m_points = std::move(points);
+		m_capacity = pointsPerTrail;
+	}
+
+	uint32_t TrailHistoryStore::Acquire()
+	{
+		uint32_t trail = m_freeTrail;
+		if (trail != NO_TRAIL)
+		{
+			m_freeTrail = m_rings[trail].nextFree;
+		}
+		else
+		{
+			trail = static_cast<uint32_t>(m_rings.size());
+			m_rings.emplace_back();
+			m_points.resize(m_points.size() + m_capacity);
+		}
+
+		m_rings[trail] = Ring{};
+		++m_activeCount;
+		return trail;
+	}
+
+	void TrailHistoryStore::Release(uint32_t trail)
+	{
+		m_rings[trail] = Ring{ 0, 0, m_freeTrail };
+		m_freeTrail = trail;
+		--m_activeCount;
+	}
+
+	void TrailHistoryStore::Push(uint32_t trail, const PositionHistoryPoint& point)
+	{
+		Ring& ring = m_rings[trail];
+		if (ring.count < m_capacity)
+		{
+			RingBegin(trail)[(ring.head + ring.count) % m_capacity] = point;
+			++ring.count;
+		}
+		else
+		{
+			RingBegin(trail)[ring.head] = point;
+			ring.head = (ring.head + 1) % m_capacity;
+		}
+	}
+
+	const PositionHistoryPoint* TrailHistoryStore::Newest(uint32_t trail) const
+	{
+		const Ring& ring = m_rings[trail];
+		if (ring.count == 0)
+		{
+			return nullptr;
+		}
+		return &RingBegin(trail)[(ring.head + ring.count - 1) % m_capacity];
+	}
+
+	uint32_t TrailHistoryStore::AppendTo(uint32_t trail, std::vector<PositionHistoryPoint>& out) const
+	{
+		const Ring& ring = m_rings[trail];
+		const PositionHistoryPoint* begin = RingBegin(trail);
+
+		// At most two contiguous runs: head..end of ring, then the wrapped part
+		const uint32_t firstRun = std::min(ring.count, m_capacity - ring.head);
+		out.insert(out.end(), begin + ring.head, begin + ring.head + firstRun);
+		out.insert(out.end(), begin, begin + (ring.count - firstRun));
+		return ring.count;
+	}
+} // namespace kx
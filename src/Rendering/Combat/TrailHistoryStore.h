@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "CombatState.h"
+
+namespace kx
+{
+	/**
+	 * @brief Pooled, fixed-capacity ring buffers of position history for movement trails
+	 *
+	 * Every trail gets the same number of points (TrailSettings::maxPoints), laid out back to
+	 * back in one flat array; pushing onto a full trail overwrites its oldest point. Only
+	 * entities that can actually draw a trail hold one, so NPCs and gadgets carry nothing but
+	 * an invalid handle. Released trails are kept on a free list and handed out again.
+	 *
+	 * Thread-safety: NOT thread-safe. Owned by the CombatStateManager.
+	 */
+	class TrailHistoryStore
+	{
+	public:
+		static constexpr uint32_t NO_TRAIL = UINT32_MAX;
+
+		/**
+		 * @brief Set the number of points every trail holds
+		 * Live trails keep their newest points when the capacity shrinks.
+		 */
+		void SetCapacity(uint32_t pointsPerTrail);
+		uint32_t GetCapacity() const { return m_capacity; }
+
+		/**
+		 * @brief Hand out an empty trail
+		 */
+		uint32_t Acquire();
+		void Release(uint32_t trail);
+
+		/**
+		 * @brief Append a point, overwriting the oldest one once the trail is full
+		 */
+		void Push(uint32_t trail, const PositionHistoryPoint& point);
+
+		/**
+		 * @brief Most recently pushed point, or nullptr for an empty trail
+		 */
+		const PositionHistoryPoint* Newest(uint32_t trail) const;
+
+		uint32_t Size(uint32_t trail) const { return m_rings[trail].count; }
+
+		/**
+		 * @brief Append a trail's points to out, oldest first
+		 * @return Number of points appended
+		 */
+		uint32_t AppendTo(uint32_t trail, std::vector<PositionHistoryPoint>& out) const;
+
+		/**
+		 * @brief Number of trails currently handed out
+		 */
+		size_t GetActiveCount() const { return m_activeCount; }
+
+	private:
+		struct Ring
+		{
+			uint32_t head = 0;      // Index of the oldest point within the ring
+			uint32_t count = 0;
+			uint32_t nextFree = NO_TRAIL;
+		};
+
+		PositionHistoryPoint* RingBegin(uint32_t trail) { return m_points.data() + static_cast<size_t>(trail) * m_capacity; }
+		const PositionHistoryPoint* RingBegin(uint32_t trail) const { return m_points.data() + static_cast<size_t>(trail) * m_capacity; }
+
+		std::vector<PositionHistoryPoint> m_points; // m_rings.size() * m_capacity points
+		std::vector<Ring> m_rings;
+		uint32_t m_capacity = 1;
+		uint32_t m_freeTrail = NO_TRAIL;
+		size_t m_activeCount = 0;
+	};
+} // namespace kx
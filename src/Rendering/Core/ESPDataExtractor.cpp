@@ -1,51 +1,109 @@
 #include "ESPDataExtractor.h"
 #include "EntityExtractor.h"
+#include "PlayerNameCache.h"
 #include "../../Game/AddressManager.h"
 #include "../../Game/ReClassStructs.h"
 #include "../../Utils/SafeIterators.h"
 #include "../../Utils/MemorySafety.h"
+#include "../../Utils/WorkStealingPool.h"
 #include "../Utils/ESPConstants.h"
 
 namespace kx {
 
-    void ESPDataExtractor::ExtractFrameData(ObjectPool<RenderablePlayer>& playerPool,
-        ObjectPool<RenderableNpc>& npcPool,
-        ObjectPool<RenderableGadget>& gadgetPool,
+    namespace {
+        // Per-range outputs, reused across updates (pipeline thread only)
+        ChunkedResults<RenderablePlayer> s_playerChunks;
+        ChunkedResults<RenderableNpc> s_npcChunks;
+        ChunkedResults<RenderableGadget> s_gadgetChunks;
+
+        // Character pointer -> UTF-8 player name, kept across updates (pipeline thread only)
+        PlayerNameCache s_playerNames;
+
+        /**
+         * @brief Run fn over every RANGE_SIZE slice of a list, in parallel once the list is large enough
+         */
+        template<typename Fn>
+        void ForEachRange(WorkStealingPool& workers, uint32_t capacity, Fn&& fn) {
+            using namespace ExtractionParallelism;
+            if (capacity < MIN_PARALLEL_CAPACITY) {
+                const size_t rangeCount = WorkStealingPool::RangeCount(capacity, RANGE_SIZE);
+                for (size_t i = 0; i < rangeCount; ++i) {
+                    const uint32_t first = static_cast<uint32_t>(i * RANGE_SIZE);
+                    const uint32_t last = (capacity - first > RANGE_SIZE) ? first + RANGE_SIZE : capacity;
+                    fn(first, last, i, 0);
+                }
+                return;
+            }
+            workers.ParallelForRanges(capacity, RANGE_SIZE, fn);
+        }
+
+        /**
+         * @brief Copy the hot fields of every extracted entity into the frame's entity table
+         */
+        void BuildEntityTable(PooledFrameRenderData& pooledData) {
+            pooledData.table.Reserve(pooledData.players.size() + pooledData.npcs.size() +
+                                     pooledData.gadgets.size() + pooledData.attackTargets.size());
+            for (RenderablePlayer* player : pooledData.players) pooledData.table.Append(player);
+            for (RenderableNpc* npc : pooledData.npcs) pooledData.table.Append(npc);
+            for (RenderableGadget* gadget : pooledData.gadgets) pooledData.table.Append(gadget);
+            for (RenderableAttackTarget* attackTarget : pooledData.attackTargets) pooledData.table.Append(attackTarget);
+        }
+    }
+
+    void ESPDataExtractor::ExtractFrameData(WorkStealingPool& workers,
+        ExtractionPool<RenderablePlayer>& playerPool,
+        ExtractionPool<RenderableNpc>& npcPool,
+        ExtractionPool<RenderableGadget>& gadgetPool,
         ObjectPool<RenderableAttackTarget>& attackTargetPool,
         PooledFrameRenderData& pooledData) {
         pooledData.Reset();
 
+        // Characters not seen during an update lose their cached fields in EndUpdate()
+        EntityExtractor::BeginUpdate();
+
         void* pContextCollection = AddressManager::GetContextCollectionPtr();
         if (!pContextCollection || !SafeAccess::IsMemorySafe(pContextCollection)) {
+            // Nothing touches the cached names this update, and the arena reclaims untouched
+            // names, so drop them here rather than hand out stale handles when the list returns
+            s_playerNames.Clear();
+            EntityExtractor::EndUpdate();
+            GetEntityNameArena().EndUpdate();
+            SafeAccess::EndValidationUpdate();
             return;
         }
 
-        // Build the map of character pointers to player names
-        std::unordered_map<void*, const wchar_t*> characterToPlayerNameMap;
+        // Sync the persistent character -> player name map with the player list
         {
             ReClass::ContextCollection ctxCollection(pContextCollection);
             ReClass::ChCliContext charContext = ctxCollection.GetChCliContext();
             if (charContext.data()) {
-                SafeAccess::PlayerList playerList(charContext);
-                for (auto playerIt = playerList.begin(); playerIt != playerList.end(); ++playerIt) {
-                    if (playerIt.IsValid()) {
-                        characterToPlayerNameMap[playerIt.GetCharacterDataPtr()] = playerIt.GetName();
-                    }
-                }
+                s_playerNames.Update(charContext);
+            } else {
+                s_playerNames.Clear();
             }
         }
 
         // Single pass extraction for both players and NPCs
-        ExtractCharacterData(playerPool, npcPool, pooledData.players, pooledData.npcs, characterToPlayerNameMap);
-        ExtractGadgetData(gadgetPool, pooledData.gadgets);
+        ExtractCharacterData(workers, playerPool, npcPool, pooledData.players, pooledData.npcs, s_playerNames);
+        EntityExtractor::EndUpdate();
+
+        ExtractGadgetData(workers, gadgetPool, pooledData.gadgets);
         ExtractAttackTargetData(attackTargetPool, pooledData.attackTargets);
+        BuildEntityTable(pooledData);
+
+        // Names no longer referenced by any entity are reclaimed after a few updates
+        GetEntityNameArena().EndUpdate();
+
+        // Pointer-validation hit rate and VirtualQuery cost for the diagnostics panel
+        SafeAccess::EndValidationUpdate();
     }
 
-    void ESPDataExtractor::ExtractCharacterData(ObjectPool<RenderablePlayer>& playerPool,
-        ObjectPool<RenderableNpc>& npcPool,
+    void ESPDataExtractor::ExtractCharacterData(WorkStealingPool& workers,
+        ExtractionPool<RenderablePlayer>& playerPool,
+        ExtractionPool<RenderableNpc>& npcPool,
         std::vector<RenderablePlayer*>& players,
         std::vector<RenderableNpc*>& npcs,
-        const std::unordered_map<void*, const wchar_t*>& characterToPlayerNameMap) {
+        const PlayerNameCache& playerNames) {
         players.clear();
         npcs.clear();
         players.reserve(ExtractionCapacity::PLAYERS_RESERVE);
@@ -60,36 +118,51 @@ namespace kx {
 
         void* localPlayerPtr = AddressManager::GetLocalPlayer();
 
-        // Single pass over the character list - process both players and NPCs
         SafeAccess::CharacterList characterList(charContext);
-        for (const auto& character : characterList) {
-            void* charPtr = const_cast<void*>(character.data());
-            
-            // Check if this character is a player
-            auto it = characterToPlayerNameMap.find(charPtr);
-            if (it != characterToPlayerNameMap.end()) {
-                // This is a player
-                RenderablePlayer* renderablePlayer = playerPool.Get();
-                if (!renderablePlayer) continue; // Pool exhausted, skip this entity
-
-                // Delegate all extraction logic to the helper class
-                if (EntityExtractor::ExtractPlayer(*renderablePlayer, character, it->second, localPlayerPtr)) {
-                    players.push_back(renderablePlayer);
-                }
-            } else {
-                // This is an NPC
-                RenderableNpc* renderableNpc = npcPool.Get();
-                if (!renderableNpc) continue; // Pool exhausted, skip this entity
-
-                // Delegate all extraction logic to the helper class
-                if (EntityExtractor::ExtractNpc(*renderableNpc, character)) {
-                    npcs.push_back(renderableNpc);
+        const uint32_t capacity = characterList.Capacity();
+        const size_t rangeCount = WorkStealingPool::RangeCount(capacity, ExtractionParallelism::RANGE_SIZE);
+        s_playerChunks.Begin(rangeCount);
+        s_npcChunks.Begin(rangeCount);
+
+        // Single pass over each range of the character list - process both players and NPCs
+        ForEachRange(workers, capacity, [&](uint32_t first, uint32_t last, size_t rangeIndex, size_t workerIndex) {
+            ObjectPool<RenderablePlayer>& workerPlayerPool = playerPool.Shard(workerIndex);
+            ObjectPool<RenderableNpc>& workerNpcPool = npcPool.Shard(workerIndex);
+            std::vector<RenderablePlayer*>& rangePlayers = s_playerChunks.Chunk(rangeIndex);
+            std::vector<RenderableNpc*>& rangeNpcs = s_npcChunks.Chunk(rangeIndex);
+
+            for (const auto& character : characterList.Range(first, last)) {
+                // Check if this character is a player
+                const StringHandle* playerName = playerNames.Find(character.data());
+                if (playerName) {
+                    // This is a player
+                    RenderablePlayer* renderablePlayer = workerPlayerPool.Get();
+                    if (!renderablePlayer) continue; // Pool exhausted, skip this entity
+
+                    // Delegate all extraction logic to the helper class
+                    if (EntityExtractor::ExtractPlayer(*renderablePlayer, character, *playerName, localPlayerPtr)) {
+                        rangePlayers.push_back(renderablePlayer);
+                    }
+                } else {
+                    // This is an NPC
+                    RenderableNpc* renderableNpc = workerNpcPool.Get();
+                    if (!renderableNpc) continue; // Pool exhausted, skip this entity
+
+                    // Delegate all extraction logic to the helper class
+                    if (EntityExtractor::ExtractNpc(*renderableNpc, character)) {
+                        rangeNpcs.push_back(renderableNpc);
+                    }
                 }
             }
-        }
+        });
+
+        // Merge in array order so the output doesn't depend on which worker ran which range
+        s_playerChunks.MergeInto(players);
+        s_npcChunks.MergeInto(npcs);
     }
 
-    void ESPDataExtractor::ExtractGadgetData(ObjectPool<RenderableGadget>& gadgetPool,
+    void ESPDataExtractor::ExtractGadgetData(WorkStealingPool& workers,
+        ExtractionPool<RenderableGadget>& gadgetPool,
         std::vector<RenderableGadget*>& gadgets) {
         gadgets.clear();
         gadgets.reserve(ExtractionCapacity::GADGETS_RESERVE);
@@ -102,15 +175,25 @@ namespace kx {
         if (!gadgetContext.data()) return;
 
         SafeAccess::GadgetList gadgetList(gadgetContext);
-        for (const auto& gadget : gadgetList) {
-            RenderableGadget* renderableGadget = gadgetPool.Get();
-            if (!renderableGadget) break; // Pool exhausted
+        const uint32_t capacity = gadgetList.Capacity();
+        s_gadgetChunks.Begin(WorkStealingPool::RangeCount(capacity, ExtractionParallelism::RANGE_SIZE));
 
-            // Delegate all extraction logic to the helper class
-            if (EntityExtractor::ExtractGadget(*renderableGadget, gadget)) {
-                gadgets.push_back(renderableGadget);
+        ForEachRange(workers, capacity, [&](uint32_t first, uint32_t last, size_t rangeIndex, size_t workerIndex) {
+            ObjectPool<RenderableGadget>& workerGadgetPool = gadgetPool.Shard(workerIndex);
+            std::vector<RenderableGadget*>& rangeGadgets = s_gadgetChunks.Chunk(rangeIndex);
+
+            for (const auto& gadget : gadgetList.Range(first, last)) {
+                RenderableGadget* renderableGadget = workerGadgetPool.Get();
+                if (!renderableGadget) break; // Pool exhausted
+
+                // Delegate all extraction logic to the helper class
+                if (EntityExtractor::ExtractGadget(*renderableGadget, gadget)) {
+                    rangeGadgets.push_back(renderableGadget);
+                }
             }
-        }
+        });
+
+        s_gadgetChunks.MergeInto(gadgets);
     }
 
     void ESPDataExtractor::ExtractAttackTargetData(ObjectPool<RenderableAttackTarget>& attackTargetPool,
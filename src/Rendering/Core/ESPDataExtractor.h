@@ -1,13 +1,23 @@
 #pragma once
 
 #include <vector>
-#include <unordered_map>
 #include "../Data/RenderableData.h"
 #include "../Data/ESPData.h"
 #include "../../Utils/ObjectPool.h"
+#include "../../Utils/ShardedObjectPool.h"
+#include "../Utils/LayoutConstants.h"
 
 namespace kx {
 
+    class WorkStealingPool;
+    class PlayerNameCache;
+
+    /**
+     * @brief Object pool with one shard per extraction worker
+     */
+    template<typename T>
+    using ExtractionPool = ShardedObjectPool<T, ExtractionParallelism::MAX_WORKERS>;
+
     /**
      * @brief Handles data extraction from game memory (Stage 1 of rendering pipeline)
      *
@@ -18,20 +28,25 @@ namespace kx {
      * Performance Optimization:
      * - Implements fail-fast validation of root ContextCollection pointer
      * - Prevents thousands of failed memory reads during loading screens or when game is not ready
+     * - Splits the character and gadget lists into index ranges extracted in parallel; each
+     *   worker fills its own pool shard and per-range results are merged in array order, so
+     *   the output order matches a serial walk
      */
     class ESPDataExtractor {
     public:
         /**
          * @brief OPTIMIZED extraction method - extracts directly into object pools (eliminates heap allocations)
+         * @param workers Pool the character and gadget ranges are distributed over (at most MAX_WORKERS participants)
          * @param playerPool Object pool for players
          * @param npcPool Object pool for NPCs
          * @param gadgetPool Object pool for gadgets
          * @param attackTargetPool Object pool for attack targets
          * @param pooledData Output container for pooled data pointers
          */
-        static void ExtractFrameData(ObjectPool<RenderablePlayer>& playerPool,
-            ObjectPool<RenderableNpc>& npcPool,
-            ObjectPool<RenderableGadget>& gadgetPool,
+        static void ExtractFrameData(WorkStealingPool& workers,
+            ExtractionPool<RenderablePlayer>& playerPool,
+            ExtractionPool<RenderableNpc>& npcPool,
+            ExtractionPool<RenderableGadget>& gadgetPool,
             ObjectPool<RenderableAttackTarget>& attackTargetPool,
             PooledFrameRenderData& pooledData);
 
@@ -39,13 +54,15 @@ namespace kx {
         /**
          * @brief OPTIMIZED extraction methods - write directly into object pools
          */
-        static void ExtractCharacterData(ObjectPool<RenderablePlayer>& playerPool,
-            ObjectPool<RenderableNpc>& npcPool,
+        static void ExtractCharacterData(WorkStealingPool& workers,
+            ExtractionPool<RenderablePlayer>& playerPool,
+            ExtractionPool<RenderableNpc>& npcPool,
             std::vector<RenderablePlayer*>& players,
             std::vector<RenderableNpc*>& npcs,
-            const std::unordered_map<void*, const wchar_t*>& characterToPlayerNameMap);
+            const PlayerNameCache& playerNames);
 
-        static void ExtractGadgetData(ObjectPool<RenderableGadget>& gadgetPool,
+        static void ExtractGadgetData(WorkStealingPool& workers,
+            ExtractionPool<RenderableGadget>& gadgetPool,
             std::vector<RenderableGadget*>& gadgets);
 
         static void ExtractAttackTargetData(ObjectPool<RenderableAttackTarget>& attackTargetPool,
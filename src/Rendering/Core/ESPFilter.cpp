@@ -1,7 +1,7 @@
 #include "ESPFilter.h"
 
 #include "AppState.h"
-#include "Utils/EntityFilter.h"
+#include "Utils/CompiledEntityFilter.h"
 #include "../Data/RenderableData.h"
 #include "../Combat/CombatStateManager.h"
 #include "../Utils/ESPConstants.h"
@@ -19,128 +19,102 @@ namespace { // Anonymous namespace for local helpers
     }
 
     /**
-     * @brief Performs common filtering logic applicable to all entity types.
-     * @return True if the entity passes common filters, false otherwise.
+     * @brief Compute camera and player distances for every row, over the position column only
      */
-    bool PassesCommonFilters(
-        RenderableEntity* entity,
-        const glm::vec3& cameraPos,
-        const glm::vec3& playerPos,
-        const DistanceSettings& distanceSettings
-    ) {
-        if (!entity || !entity->isValid) {
-            return false;
+    void ComputeDistances(EntityTable& table, const glm::vec3& cameraPos, const glm::vec3& playerPos) {
+        const size_t rowCount = table.Size();
+        for (size_t i = 0; i < rowCount; ++i) {
+            table.visualDistances[i] = glm::length(table.positions[i] - cameraPos);
+            table.gameplayDistances[i] = glm::length(table.positions[i] - playerPos);
         }
+    }
+
+    /**
+     * @brief Type-specific filters, evaluated on the hot columns of one row
+     * @return True if the entity in this row should be rendered
+     */
+    bool PassesTypeFilters(const EntityTable& table, size_t row, const Settings& settings,
+                           const Filtering::CompiledEntityFilter& entityFilter,
+                           const CombatStateManager& stateManager, uint64_t now) {
+        const float currentHealth = table.currentHealth[row];
 
-        entity->visualDistance = glm::length(entity->position - cameraPos);
-        entity->gameplayDistance = glm::length(entity->position - playerPos);
+        switch (table.entityTypes[row]) {
+            case ESPEntityType::Player:
+                if ((table.flags[row] & EntityRowFlags::LOCAL_PLAYER) && !settings.playerESP.showLocalPlayer) return false;
+                if (currentHealth <= 0.0f && !IsDeathAnimationPlaying(table.entities[row]->address, stateManager, now)) {
+                    return false;
+                }
+                return entityFilter.ShouldRenderPlayer(table.attitudes[row]);
 
-        if (distanceSettings.useDistanceLimit && entity->gameplayDistance > distanceSettings.renderDistanceLimit) {
-            return false;
-        }
+            case ESPEntityType::NPC:
+                if (currentHealth <= 0.0f && !settings.npcESP.showDeadNpcs && !IsDeathAnimationPlaying(table.entities[row]->address, stateManager, now)) {
+                    return false;
+                }
+                return entityFilter.ShouldRenderNpc(table.attitudes[row], static_cast<Game::CharacterRank>(table.subtypes[row]));
+
+            case ESPEntityType::Gadget: {
+                const auto type = static_cast<Game::GadgetType>(table.subtypes[row]);
+                if (table.maxHealth[row] > 0 && currentHealth <= 0.0f && !settings.objectESP.showDeadGadgets &&
+                    !IsDeathAnimationPlaying(table.entities[row]->address, stateManager, now)) {
+                    return false;
+                }
+                if (settings.hideDepletedNodes && type == Game::GadgetType::ResourceNode && !(table.flags[row] & EntityRowFlags::GATHERABLE)) {
+                    return false;
+                }
+                // Note: Max height check is handled in context factory to disable box rendering only
+                // Entity is still rendered with other visualizations (circles, dots, details, etc.)
+                return entityFilter.ShouldRenderGadget(type);
+            }
 
-        return true;
+            case ESPEntityType::AttackTarget:
+                // Filter by combat state if enabled
+                if (settings.objectESP.showAttackTargetListOnlyInCombat) {
+                    return static_cast<Game::AttackTargetCombatState>(table.subtypes[row]) == Game::AttackTargetCombatState::InCombat;
+                }
+                return true;
+        }
+        return false;
     }
 
 } // anonymous namespace
 
-void ESPFilter::FilterPooledData(const PooledFrameRenderData& extractedData, Camera& camera,
-                                 PooledFrameRenderData& filteredData, const CombatStateManager& stateManager, uint64_t now) {
+void ESPFilter::FilterPooledData(PooledFrameRenderData& extractedData, Camera& camera, const Settings& settings,
+                                 PooledFrameRenderData& filteredData, const Filtering::CompiledEntityFilter& entityFilter,
+                                 const CombatStateManager& stateManager, uint64_t now) {
     filteredData.Reset();
-    
-    const auto& settings = AppState::Get().GetSettings();
     const glm::vec3 playerPos = camera.GetPlayerPosition();
     const glm::vec3 cameraPos = camera.GetCameraPosition();
-    
-    // Filter players
-    if (settings.playerESP.enabled) {
-        filteredData.players.reserve(extractedData.players.size());
-        for (RenderablePlayer* player : extractedData.players) {
-            // Call the common helper function first
-            if (!PassesCommonFilters(player, cameraPos, playerPos, settings.distance)) {
-                continue;
-            }
-            
-            // Now, perform player-specific filtering
-            if (player->isLocalPlayer && !settings.playerESP.showLocalPlayer) continue;
-            
-            if (player->currentHealth <= 0.0f && !IsDeathAnimationPlaying(player->address, stateManager, now)) {
-                continue;
-            }
-            
-            if (!Filtering::EntityFilter::ShouldRenderPlayer(player->attitude, settings.playerESP)) continue;
-            
-            filteredData.players.push_back(player);
-        }
-    }
-    
-    // Filter NPCs
-    if (settings.npcESP.enabled) {
-        filteredData.npcs.reserve(extractedData.npcs.size());
-        for (RenderableNpc* npc : extractedData.npcs) {
-            // Call the common helper function first
-            if (!PassesCommonFilters(npc, cameraPos, playerPos, settings.distance)) {
-                continue;
-            }
-            
-            // Now, perform NPC-specific filtering
-            if (npc->currentHealth <= 0.0f && !settings.npcESP.showDeadNpcs && !IsDeathAnimationPlaying(npc->address, stateManager, now)) {
-                continue;
-            }
-            
-            if (!Filtering::EntityFilter::ShouldRenderNpc(npc->attitude, npc->rank, settings.npcESP)) continue;
-            
-            filteredData.npcs.push_back(npc);
+
+    EntityTable& table = extractedData.table;
+    ComputeDistances(table, cameraPos, playerPos);
+
+    filteredData.table.Reserve(table.Size());
+    const size_t rowCount = table.Size();
+    for (size_t i = 0; i < rowCount; ++i) {
+        const ESPEntityType type = table.entityTypes[i];
+        if (!entityFilter.IsCategoryEnabled(type) || !(table.flags[i] & EntityRowFlags::VALID)) {
+            continue;
         }
-    }
-    
-    // Filter gadgets
-    if (settings.objectESP.enabled) {
-        filteredData.gadgets.reserve(extractedData.gadgets.size());
-        for (RenderableGadget* gadget : extractedData.gadgets) {
-            // Call the common helper function first
-            if (!PassesCommonFilters(gadget, cameraPos, playerPos, settings.distance)) {
-                continue;
-            }
 
-            // Now, perform gadget-specific filtering
-            if (gadget->maxHealth > 0 && gadget->currentHealth <= 0.0f && !settings.objectESP.showDeadGadgets && !IsDeathAnimationPlaying(gadget->address, stateManager, now)) {
-                continue;
-            }
+        if (settings.distance.useDistanceLimit && table.gameplayDistances[i] > settings.distance.renderDistanceLimit) {
+            continue;
+        }
 
-            if (settings.hideDepletedNodes && gadget->type == Game::GadgetType::ResourceNode && !gadget->isGatherable) {
-                continue;
-            }
-            
-            if (!Filtering::EntityFilter::ShouldRenderGadget(gadget->type, settings.objectESP)) continue;
-            
-            // Note: Max height check is handled in context factory to disable box rendering only
-            // Entity is still rendered with other visualizations (circles, dots, details, etc.)
-            
-            filteredData.gadgets.push_back(gadget);
+        if (!PassesTypeFilters(table, i, settings, entityFilter, stateManager, now)) {
+            continue;
         }
-    }
-    
-    // Filter attack targets
-    if (settings.objectESP.enabled && settings.objectESP.showAttackTargetList) {
-        filteredData.attackTargets.reserve(extractedData.attackTargets.size());
-        for (RenderableAttackTarget* attackTarget : extractedData.attackTargets) {
-            // Call the common helper function first
-            if (!PassesCommonFilters(attackTarget, cameraPos, playerPos, settings.distance)) {
-                continue;
-            }
 
-            // Filter by combat state if enabled
-            if (settings.objectESP.showAttackTargetListOnlyInCombat) {
-                if (attackTarget->combatState != Game::AttackTargetCombatState::InCombat) {
-                    continue;
-                }
-            }
+        // Only passing entities are touched: later stages read their distances from the renderable
+        RenderableEntity* entity = table.entities[i];
+        entity->visualDistance = table.visualDistances[i];
+        entity->gameplayDistance = table.gameplayDistances[i];
+        filteredData.table.AppendRow(table, i);
 
-            // Note: Max height check is handled in context factory to disable box rendering only
-            // Entity is still rendered with other visualizations (circles, dots, details, etc.)
-            
-            filteredData.attackTargets.push_back(attackTarget);
+        switch (type) {
+            case ESPEntityType::Player:       filteredData.players.push_back(static_cast<RenderablePlayer*>(entity)); break;
+            case ESPEntityType::NPC:          filteredData.npcs.push_back(static_cast<RenderableNpc*>(entity)); break;
+            case ESPEntityType::Gadget:       filteredData.gadgets.push_back(static_cast<RenderableGadget*>(entity)); break;
+            case ESPEntityType::AttackTarget: filteredData.attackTargets.push_back(static_cast<RenderableAttackTarget*>(entity)); break;
         }
     }
 }
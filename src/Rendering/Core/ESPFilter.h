@@ -6,18 +6,26 @@
 namespace kx {
 
     class CombatStateManager; // Forward declaration
+    namespace Filtering { class CompiledEntityFilter; }
 
 class ESPFilter {
 public:
     /**
      * @brief OPTIMIZED filter method - filters already pooled data (no object allocations)
+     *
+     * Runs over the hot columns of the extracted entity table. Distances are written to the
+     * extracted table for every row, and to the renderable itself for rows that pass.
+     *
      * @param extractedData Input pooled data from extraction
      * @param camera Camera for distance calculations
-     * @param filteredData Output filtered pooled data
+     * @param settings Settings snapshot of this update
+     * @param filteredData Output filtered pooled data (lists and table rows of passing entities)
+     * @param entityFilter Category, attitude, rank and gadget type verdicts compiled from the current settings
      * @param stateManager The combat state manager for state-aware filtering
      */
-    static void FilterPooledData(const PooledFrameRenderData& extractedData, Camera& camera,
-                                 PooledFrameRenderData& filteredData, const CombatStateManager& stateManager, uint64_t now);
+    static void FilterPooledData(PooledFrameRenderData& extractedData, Camera& camera, const Settings& settings,
+                                 PooledFrameRenderData& filteredData, const Filtering::CompiledEntityFilter& entityFilter,
+                                 const CombatStateManager& stateManager, uint64_t now);
 
 };
 
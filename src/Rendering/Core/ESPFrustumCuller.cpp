@@ -0,0 +1,48 @@
+#include "ESPFrustumCuller.h"
+
+#include <vector>
+#include "../Utils/FrustumCulling.h"
+
+namespace kx {
+
+FrustumCullStats ESPFrustumCuller::CullPooledData(const PooledFrameRenderData& filteredData, const Camera& camera,
+                                                  PooledFrameRenderData& visibleData) {
+    visibleData.Reset();
+
+    const EntityTable& table = filteredData.table;
+    const size_t rowCount = table.Size();
+
+    FrustumCulling::Planes planes = camera.GetFrustumPlanes();
+    for (glm::vec4& plane : planes) {
+        plane.w += FrustumCullConfig::PLANE_MARGIN;
+    }
+
+    // One verdict per row over the hot columns; renderables are only touched for survivors
+    thread_local std::vector<uint8_t> rowVisible;
+    rowVisible.resize(rowCount);
+    const size_t visibleCount = FrustumCulling::CullBoxes(planes, table.positions, table.boundsHalfExtents.data(), rowVisible.data());
+
+    visibleData.table.Reserve(visibleCount);
+    for (size_t i = 0; i < rowCount; ++i) {
+        if (!rowVisible[i]) {
+            continue;
+        }
+
+        visibleData.table.AppendRow(table, i);
+
+        RenderableEntity* entity = table.entities[i];
+        switch (table.entityTypes[i]) {
+            case ESPEntityType::Player:       visibleData.players.push_back(static_cast<RenderablePlayer*>(entity)); break;
+            case ESPEntityType::NPC:          visibleData.npcs.push_back(static_cast<RenderableNpc*>(entity)); break;
+            case ESPEntityType::Gadget:       visibleData.gadgets.push_back(static_cast<RenderableGadget*>(entity)); break;
+            case ESPEntityType::AttackTarget: visibleData.attackTargets.push_back(static_cast<RenderableAttackTarget*>(entity)); break;
+        }
+    }
+
+    FrustumCullStats stats;
+    stats.tested = rowCount;
+    stats.culled = rowCount - visibleCount;
+    return stats;
+}
+
+} // namespace kx
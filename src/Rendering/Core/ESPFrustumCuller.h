@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include "../Data/ESPData.h"
+#include "../../Game/Camera.h"
+
+namespace kx {
+
+namespace FrustumCullConfig {
+    // Planes are pushed out by this many meters, so rounding never culls a box touching the frustum
+    constexpr float PLANE_MARGIN = 0.05f;
+}
+
+/**
+ * @brief Rows tested and culled by the most recent frustum cull pass
+ */
+struct FrustumCullStats {
+    size_t tested = 0;
+    size_t culled = 0;
+
+    float GetCullRatio() const {
+        return tested > 0 ? static_cast<float>(culled) / static_cast<float>(tested) : 0.0f;
+    }
+};
+
+class ESPFrustumCuller {
+public:
+    /**
+     * @brief Drop filtered entities whose world box lies entirely outside the camera frustum
+     *
+     * Runs between filtering and visuals over the position and bounds columns of the filtered
+     * table only (see FrustumCulling::CullBoxes). The test is conservative: every entity whose
+     * position could project onto the screen survives, so the visuals stage sees the same
+     * on-screen entities as before, but combat animation state, details and render contexts
+     * are no longer looked at for the ones behind or beside the camera.
+     *
+     * @param filteredData Input pooled data from the filter stage
+     * @param camera Camera whose frustum planes are tested against
+     * @param visibleData Output pooled data (lists and table rows of entities that may be visible)
+     * @return Rows tested and culled, for the diagnostics panel
+     */
+    static FrustumCullStats CullPooledData(const PooledFrameRenderData& filteredData, const Camera& camera,
+                                           PooledFrameRenderData& visibleData);
+};
+
+} // namespace kx
@@ -0,0 +1,202 @@
+#define NOMINMAX
+
+#include "ESPPipelineWorker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <Windows.h>
+
+#include "../../Core/AppState.h"
+#include "../../Utils/DebugLogger.h"
+#include "ESPDataExtractor.h"
+#include "ESPFilter.h"
+#include "ESPFrustumCuller.h"
+#include "ESPVisualsProcessor.h"
+#include "../Combat/CombatStateManager.h"
+
+namespace kx {
+
+ESPPipelineWorker::ESPPipelineWorker(CombatStateManager& combatStateManager)
+    : m_combatStateManager(combatStateManager) {
+}
+
+ESPPipelineWorker::~ESPPipelineWorker() {
+    Stop();
+}
+
+void ESPPipelineWorker::Start() {
+    if (m_thread.joinable()) {
+        return;
+    }
+
+    // Leave most cores to the game; the pipeline thread itself is one of the participants
+    const size_t hardwareThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    const size_t participants = std::clamp<size_t>(hardwareThreads / 2, 1, ExtractionParallelism::MAX_WORKERS);
+    m_extractionWorkers.Start(participants - 1);
+
+    m_thread = std::jthread([this](std::stop_token stopToken) { Run(stopToken); });
+    LOG_INFO("ESPPipelineWorker: Started (%zu extraction workers)", participants);
+}
+
+void ESPPipelineWorker::Stop() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+
+    m_thread.request_stop();
+    m_wakeCondition.notify_all();
+    m_thread.join();
+    m_extractionWorkers.Stop();
+    LOG_INFO("ESPPipelineWorker: Stopped");
+}
+
+void ESPPipelineWorker::SubmitFrameInput(const Camera& camera, float screenWidth, float screenHeight) {
+    PipelineFrameInput& input = m_inputs.WriteBuffer();
+    input.camera = camera;
+    input.screenWidth = screenWidth;
+    input.screenHeight = screenHeight;
+    m_inputs.Publish();
+}
+
+const ESPFrameSnapshot& ESPPipelineWorker::AcquireLatestSnapshot() {
+    m_snapshots.Acquire();
+    return m_snapshots.ReadBuffer();
+}
+
+void ESPPipelineWorker::Run(std::stop_token stopToken) {
+    while (!stopToken.stop_requested()) {
+        const auto tickStart = std::chrono::steady_clock::now();
+
+        // One immutable settings snapshot per update, so every stage sees a consistent view
+        const SettingsSnapshot settings = AppState::Get().GetSettingsSnapshot();
+        const auto updateInterval = std::chrono::duration<float>(1.0f / std::max(1.0f, settings.Get().espUpdateRate));
+
+        // Only run when the render thread has submitted a frame since the last update;
+        // otherwise nothing would consume the snapshot (ESP hidden, map open, etc.)
+        if (m_inputs.Acquire() && !AppState::Get().IsShuttingDown()) {
+            RunPipeline(m_inputs.ReadBuffer(), settings, GetTickCount64());
+        }
+
+        std::unique_lock lock(m_wakeMutex);
+        m_wakeCondition.wait_until(lock, stopToken,
+            tickStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(updateInterval),
+            [] { return false; });
+    }
+}
+
+void ESPPipelineWorker::RunPipeline(const PipelineFrameInput& input, const SettingsSnapshot& settingsSnapshot, uint64_t now) {
+    const Settings& settings = settingsSnapshot.Get();
+    ESPFrameSnapshot& snapshot = m_snapshots.WriteBuffer();
+    snapshot.Reset();
+    m_extractedData.Reset();
+    m_filteredData.Reset();
+    m_visibleData.Reset();
+
+    // The worker owns its own copy of the camera for the duration of the update
+    Camera camera = input.camera;
+    FrameContext frameContext = {
+        now,
+        camera,
+        m_combatStateManager,
+        settings,
+        settingsSnapshot.version,
+        nullptr, // No draw list - nothing is drawn on this thread
+        input.screenWidth,
+        input.screenHeight
+    };
+
+    // Stage 1: Extract
+    ESPDataExtractor::ExtractFrameData(m_extractionWorkers, snapshot.playerPool, snapshot.npcPool,
+                                       snapshot.gadgetPool, snapshot.attackTargetPool, m_extractedData);
+    PublishPoolStats(snapshot);
+
+    // Stage 1.5: Update combat state, then drop the state of every entity this update didn't extract
+    m_allEntities.clear();
+    m_allEntities.insert(m_allEntities.end(), m_extractedData.players.begin(), m_extractedData.players.end());
+    m_allEntities.insert(m_allEntities.end(), m_extractedData.npcs.begin(), m_extractedData.npcs.end());
+    m_allEntities.insert(m_allEntities.end(), m_extractedData.gadgets.begin(), m_extractedData.gadgets.end());
+    m_allEntities.insert(m_allEntities.end(), m_extractedData.attackTargets.begin(), m_extractedData.attackTargets.end());
+    m_combatStateManager.Update(m_allEntities, settings.playerESP.trails, now);
+    m_combatStateManager.Prune();
+
+    // Stage 2: Filter (per-entity setting checks become bit tests on the compiled table,
+    // which is only recompiled when the settings version moves on)
+    m_entityFilterObserver.Refresh(settingsSnapshot, [this](const Settings& current) { m_entityFilter.Compile(current); });
+    ESPFilter::FilterPooledData(m_extractedData, camera, settings, m_filteredData, m_entityFilter, m_combatStateManager, now);
+
+    // Stage 2.2: Cull entities outside the camera frustum before any per-entity visuals work
+    const FrustumCullStats cullStats = ESPFrustumCuller::CullPooledData(m_filteredData, camera, m_visibleData);
+    {
+        std::lock_guard lock(m_poolStatsMutex);
+        m_cullStats = cullStats;
+    }
+
+    // Stage 2.5: Calculate Visuals
+    ESPVisualsProcessor::Process(frameContext, m_visibleData, snapshot.renderData);
+
+    // Stage 2.7: Copy trail history into the snapshot - the render thread never touches combat state
+    CaptureTrailHistory(settings, snapshot.renderData);
+
+    // Stage 2.8: Update adaptive far plane (use extracted data for true scene depth)
+    AppState::Get().UpdateAdaptiveFarPlane(m_extractedData);
+
+    snapshot.timestamp = now;
+    m_snapshots.Publish();
+}
+
+PipelinePoolStats ESPPipelineWorker::GetPoolStats() const {
+    std::lock_guard lock(m_poolStatsMutex);
+    return m_poolStats;
+}
+
+FrustumCullStats ESPPipelineWorker::GetCullStats() const {
+    std::lock_guard lock(m_poolStatsMutex);
+    return m_cullStats;
+}
+
+void ESPPipelineWorker::PublishPoolStats(const ESPFrameSnapshot& snapshot) {
+    PipelinePoolStats stats;
+    stats.players = snapshot.playerPool.GetStats();
+    stats.npcs = snapshot.npcPool.GetStats();
+    stats.gadgets = snapshot.gadgetPool.GetStats();
+    stats.attackTargets = snapshot.attackTargetPool.GetStats();
+
+    std::lock_guard lock(m_poolStatsMutex);
+    auto merge = [](ObjectPoolStats& current, const ObjectPoolStats& previous, const char* poolName) {
+        // Each snapshot keeps its own high-water mark; report the highest seen by any of them
+        current.highWater = std::max(current.highWater, previous.highWater);
+
+        // Warn when a pool starts refusing objects, not on every update it stays full
+        if (current.exhaustedRequests > 0 && previous.exhaustedRequests == 0) {
+            LOG_WARN("ESPPipelineWorker: %s pool exhausted (%zu in use, %zu refused)",
+                     poolName, current.used, current.exhaustedRequests);
+        }
+    };
+    merge(stats.players, m_poolStats.players, "Player");
+    merge(stats.npcs, m_poolStats.npcs, "NPC");
+    merge(stats.gadgets, m_poolStats.gadgets, "Gadget");
+    merge(stats.attackTargets, m_poolStats.attackTargets, "Attack target");
+    m_poolStats = stats;
+}
+
+void ESPPipelineWorker::CaptureTrailHistory(const Settings& settings, PooledFrameRenderData& renderData) const {
+    if (!settings.playerESP.trails.enabled) {
+        return;
+    }
+
+    for (auto& item : renderData.finalizedEntities) {
+        if (item.entity->entityType != ESPEntityType::Player) {
+            continue;
+        }
+
+        const EntityCombatState* state = m_combatStateManager.GetState(item.entity->address);
+        if (!state || state->trail == TrailHistoryStore::NO_TRAIL) {
+            continue;
+        }
+
+        item.trailOffset = static_cast<uint32_t>(renderData.trailHistory.size());
+        item.trailCount = m_combatStateManager.GetTrailHistory().AppendTo(state->trail, renderData.trailHistory);
+    }
+}
+
+} // namespace kx
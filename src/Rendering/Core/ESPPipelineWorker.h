@@ -0,0 +1,164 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include "../../Core/SettingsSnapshot.h"
+#include "../../Game/Camera.h"
+#include "../../Utils/MemorySafety.h"
+#include "../../Utils/ObjectPool.h"
+#include "../../Utils/TripleBuffer.h"
+#include "../../Utils/WorkStealingPool.h"
+#include "../Data/ESPData.h"
+#include "../Data/RenderableData.h"
+#include "../Utils/CompiledEntityFilter.h"
+#include "ESPDataExtractor.h"
+#include "ESPFrustumCuller.h"
+
+namespace kx {
+
+class CombatStateManager;
+struct Settings;
+struct SettingsSnapshot;
+
+/**
+ * @brief Pool growth policy for a single pipeline snapshot
+ *
+ * Pools start with one segment and grow as the scene needs; each may grow up to the
+ * largest list it is filled from, so extraction never drops entities for lack of space.
+ * Segments a snapshot hasn't needed for about a minute are released again.
+ */
+namespace PipelinePoolConfig {
+    constexpr uint32_t RELEASE_IDLE_AFTER_RESETS = 3600; // ~1 minute at the default update rate
+
+    constexpr ObjectPoolConfig PLAYERS{ 64, SafeAccess::MAX_REASONABLE_PLAYER_COUNT, RELEASE_IDLE_AFTER_RESETS };
+    constexpr ObjectPoolConfig NPCS{ 256, SafeAccess::MAX_REASONABLE_CHARACTER_COUNT, RELEASE_IDLE_AFTER_RESETS };
+    constexpr ObjectPoolConfig GADGETS{ 512, SafeAccess::MAX_REASONABLE_GADGET_COUNT, RELEASE_IDLE_AFTER_RESETS };
+    constexpr ObjectPoolConfig ATTACK_TARGETS{ 128, SafeAccess::MAX_REASONABLE_ATTACK_TARGET_COUNT, RELEASE_IDLE_AFTER_RESETS };
+}
+
+/**
+ * @brief Per-type pool counters of the most recent pipeline update
+ */
+struct PipelinePoolStats {
+    ObjectPoolStats players;
+    ObjectPoolStats npcs;
+    ObjectPoolStats gadgets;
+    ObjectPoolStats attackTargets;
+};
+
+/**
+ * @brief Everything the render thread needs to draw one completed pipeline update
+ *
+ * Each snapshot owns the object pools its renderables live in, so the pointers and
+ * references held by finalized entities stay valid for as long as the render thread
+ * holds the snapshot, independent of what the worker is writing. Character and gadget
+ * pools are sharded per extraction worker.
+ */
+struct ESPFrameSnapshot {
+    ExtractionPool<RenderablePlayer> playerPool{ PipelinePoolConfig::PLAYERS };
+    ExtractionPool<RenderableNpc> npcPool{ PipelinePoolConfig::NPCS };
+    ExtractionPool<RenderableGadget> gadgetPool{ PipelinePoolConfig::GADGETS };
+    ObjectPool<RenderableAttackTarget> attackTargetPool{ PipelinePoolConfig::ATTACK_TARGETS };
+
+    PooledFrameRenderData renderData;
+    uint64_t timestamp = 0;
+
+    void Reset() {
+        playerPool.Reset();
+        npcPool.Reset();
+        gadgetPool.Reset();
+        attackTargetPool.Reset();
+        renderData.Reset();
+        timestamp = 0;
+    }
+};
+
+/**
+ * @brief Per-frame inputs handed from the render thread to the pipeline worker
+ */
+struct PipelineFrameInput {
+    Camera camera;
+    float screenWidth = 0.0f;
+    float screenHeight = 0.0f;
+};
+
+/**
+ * @brief Runs the low-frequency ESP update pipeline on a dedicated thread
+ *
+ * Extraction, combat state updates, filtering, frustum culling, visual processing and the adaptive far
+ * plane update all run here at settings.espUpdateRate. Completed results are published
+ * as immutable snapshots through a lock-free triple buffer, so the Present hook only
+ * ever picks up the newest snapshot and its cost no longer depends on entity count.
+ *
+ * The worker only ticks while the render thread keeps submitting frame inputs; when
+ * the ESP is hidden (map open, no ImGui context) the pipeline idles.
+ */
+class ESPPipelineWorker {
+public:
+    explicit ESPPipelineWorker(CombatStateManager& combatStateManager);
+    ~ESPPipelineWorker();
+
+    ESPPipelineWorker(const ESPPipelineWorker&) = delete;
+    ESPPipelineWorker& operator=(const ESPPipelineWorker&) = delete;
+
+    void Start();
+    void Stop();
+    bool IsRunning() const { return m_thread.joinable(); }
+
+    /**
+     * @brief Hand the latest camera and screen size to the worker (render thread only)
+     */
+    void SubmitFrameInput(const Camera& camera, float screenWidth, float screenHeight);
+
+    /**
+     * @brief Get the newest completed snapshot (render thread only)
+     * The returned reference stays valid until the next call.
+     */
+    const ESPFrameSnapshot& AcquireLatestSnapshot();
+
+    /**
+     * @brief Pool counters of the last update's snapshot, with high-water marks over all updates (any thread)
+     */
+    PipelinePoolStats GetPoolStats() const;
+
+    /**
+     * @brief Frustum cull counters of the last update (any thread)
+     */
+    FrustumCullStats GetCullStats() const;
+
+private:
+    void Run(std::stop_token stopToken);
+    void RunPipeline(const PipelineFrameInput& input, const SettingsSnapshot& settingsSnapshot, uint64_t now);
+    void CaptureTrailHistory(const Settings& settings, PooledFrameRenderData& renderData) const;
+    void PublishPoolStats(const ESPFrameSnapshot& snapshot);
+
+    CombatStateManager& m_combatStateManager;
+
+    TripleBuffer<PipelineFrameInput> m_inputs;
+    TripleBuffer<ESPFrameSnapshot> m_snapshots;
+
+    // Helpers for chunked character/gadget extraction; the pipeline thread participates as worker 0
+    WorkStealingPool m_extractionWorkers;
+
+    // Intermediate stage buffers, reused across updates (worker thread only)
+    PooledFrameRenderData m_extractedData;
+    PooledFrameRenderData m_filteredData;
+    PooledFrameRenderData m_visibleData;          // Filtered entities that survived the frustum cull
+    std::vector<RenderableEntity*> m_allEntities; // Every extracted entity, for the combat state update
+    Filtering::CompiledEntityFilter m_entityFilter; // Filter verdicts of the current settings version
+    SettingsObserver m_entityFilterObserver;
+
+    // Pool and cull counters for the diagnostics panel
+    mutable std::mutex m_poolStatsMutex;
+    PipelinePoolStats m_poolStats;
+    FrustumCullStats m_cullStats;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable_any m_wakeCondition;
+    std::jthread m_thread;
+};
+
+} // namespace kx
@@ -3,17 +3,10 @@
 #include "ESPRenderer.h"
 #include "../Data/ESPData.h"
 
-#include <algorithm>
-#include <unordered_set>
 #include <Windows.h>
 
 #include "../../Core/AppState.h"
-#include "../../Utils/ObjectPool.h"
-#include "../Utils/ESPMath.h"
-#include "../Data/RenderableData.h"
-#include "ESPDataExtractor.h"
-#include "ESPFilter.h"
-#include "ESPVisualsProcessor.h"
+#include "ESPPipelineWorker.h"
 #include "ESPStageRenderer.h"
 #include "../Combat/CombatStateManager.h"
 #include "../../../libs/ImGui/imgui.h"
@@ -23,70 +16,20 @@ namespace kx {
 // Initialize the static camera pointer
 Camera* ESPRenderer::s_camera = nullptr;
 
-// Object pools to eliminate heap churn - pre-allocate reasonable number of entities
-static ObjectPool<RenderablePlayer> s_playerPool(500);
-static ObjectPool<RenderableNpc> s_npcPool(2000);
-static ObjectPool<RenderableGadget> s_gadgetPool(5000);
-static ObjectPool<RenderableAttackTarget> s_attackTargetPool(1000);
-
-// Static variables for frame rate limiting and three-stage pipeline
-static PooledFrameRenderData s_processedRenderData; // Filtered data ready for rendering
-static float s_lastUpdateTime = 0.0f;
+// Combat state is owned and mutated exclusively by the pipeline worker thread.
+// The render thread only consumes the immutable snapshots the worker publishes.
 static CombatStateManager g_combatStateManager;
+static ESPPipelineWorker s_pipelineWorker(g_combatStateManager);
 
 void ESPRenderer::Initialize(Camera& camera) {
     s_camera = &camera;
+    s_pipelineWorker.Start();
 }
 
-void ESPRenderer::UpdateESPData(const FrameContext& frameContext, float currentTimeSeconds) {
-    float espUpdateInterval = 1.0f / std::max(1.0f, frameContext.settings.espUpdateRate);
-
-    if (currentTimeSeconds - s_lastUpdateTime >= espUpdateInterval) {
-        // Reset object pools to reuse all objects for this frame
-        s_playerPool.Reset();
-        s_npcPool.Reset();
-        s_gadgetPool.Reset();
-        s_attackTargetPool.Reset();
-        s_processedRenderData.Reset();
-        
-        // Stage 1: Extract
-        PooledFrameRenderData extractedData;
-        ESPDataExtractor::ExtractFrameData(s_playerPool, s_npcPool, s_gadgetPool, s_attackTargetPool, extractedData);
-        
-        // Build a set of all currently active entity addresses
-        std::unordered_set<const void*> activeEntities;
-        for (auto* e : extractedData.players) { activeEntities.insert(e->address); }
-        for (auto* e : extractedData.npcs) { activeEntities.insert(e->address); }
-        for (auto* e : extractedData.gadgets) { activeEntities.insert(e->address); }
-        for (auto* e : extractedData.attackTargets) { activeEntities.insert(e->address); }
-
-        // Tell the CombatStateManager to remove any state for entities that no longer exist.
-        g_combatStateManager.Prune(activeEntities);
-        
-        // Stage 1.5: Update combat state
-        std::vector<RenderableEntity*> allEntities;
-        allEntities.reserve(extractedData.players.size() + extractedData.npcs.size() + extractedData.gadgets.size() + extractedData.attackTargets.size());
-        allEntities.insert(allEntities.end(), extractedData.players.begin(), extractedData.players.end());
-        allEntities.insert(allEntities.end(), extractedData.npcs.begin(), extractedData.npcs.end());
-        allEntities.insert(allEntities.end(), extractedData.gadgets.begin(), extractedData.gadgets.end());
-        allEntities.insert(allEntities.end(), extractedData.attackTargets.begin(), extractedData.attackTargets.end());
-        g_combatStateManager.Update(allEntities, frameContext.now);
-        
-        // Stage 2: Filter
-        PooledFrameRenderData filteredData;
-        ESPFilter::FilterPooledData(extractedData, *s_camera, filteredData, g_combatStateManager, frameContext.now);
-        
-        // Stage 2.5: Calculate Visuals
-        ESPVisualsProcessor::Process(frameContext, filteredData, s_processedRenderData);
-
-        // Stage 2.8: Update adaptive far plane (use extracted data for true scene depth)
-        AppState::Get().UpdateAdaptiveFarPlane(extractedData);
-        
-        s_lastUpdateTime = currentTimeSeconds;
-    }
+void ESPRenderer::Shutdown() {
+    s_pipelineWorker.Stop();
 }
 
-
 void ESPRenderer::Render(float screenWidth, float screenHeight, const MumbleLinkData* mumbleData) {
     if (!s_camera || ShouldHideESP(mumbleData)) {
         return;
@@ -98,24 +41,36 @@ void ESPRenderer::Render(float screenWidth, float screenHeight, const MumbleLink
     }
 
     const uint64_t now = GetTickCount64();
-    const float currentTimeSeconds = now / 1000.0f;
 
-    // 1. Create the context for the current frame
+    // 1. Hand this frame's camera to the pipeline worker for its next update
+    s_pipelineWorker.SubmitFrameInput(*s_camera, screenWidth, screenHeight);
+
+    // 2. Pick up the newest completed snapshot - never waits on the worker
+    const ESPFrameSnapshot& snapshot = s_pipelineWorker.AcquireLatestSnapshot();
+
+    // 3. Create the context for the current frame, over one settings snapshot for the whole frame
+    const SettingsSnapshot settings = AppState::Get().GetSettingsSnapshot();
     FrameContext frameContext = {
         now,
         *s_camera,
         g_combatStateManager,
-        AppState::Get().GetSettings(),
+        settings.Get(),
+        settings.version,
         ImGui::GetBackgroundDrawList(),
         screenWidth,
         screenHeight
     };
 
-    // 2. Run the low-frequency logic/update pipeline if needed
-    UpdateESPData(frameContext, currentTimeSeconds);
+    // 4. Render the final, processed data every frame
+    ESPStageRenderer::RenderFrameData(frameContext, snapshot.renderData);
+}
+
+PipelinePoolStats ESPRenderer::GetPoolStats() {
+    return s_pipelineWorker.GetPoolStats();
+}
 
-    // 3. Render the final, processed data every frame
-    ESPStageRenderer::RenderFrameData(frameContext, s_processedRenderData);
+FrustumCullStats ESPRenderer::GetCullStats() {
+    return s_pipelineWorker.GetCullStats();
 }
 
 bool ESPRenderer::ShouldHideESP(const MumbleLinkData* mumbleData) {
@@ -125,4 +80,4 @@ bool ESPRenderer::ShouldHideESP(const MumbleLinkData* mumbleData) {
     return false;
 }
 
-} // namespace kx
\ No newline at end of file
+} // namespace kx
@@ -6,24 +6,34 @@
 
 namespace kx {
 
+struct PipelinePoolStats;
+struct FrustumCullStats;
+
 class ESPRenderer {
 public:
     static void Initialize(Camera& camera);
+
+    /**
+     * @brief Stops the pipeline worker thread. Must be called before hooks and ImGui are torn down.
+     */
+    static void Shutdown();
+
     static void Render(float screenWidth, float screenHeight, const MumbleLinkData* mumbleData);
 
-private:
-    static bool ShouldHideESP(const MumbleLinkData* mumbleData);
-    
     /**
-     * @brief Executes the low-frequency data processing pipeline if the update interval has passed.
-     * This includes data extraction, combat state updates, filtering, and visual processing.
-     * @param context The current frame's context.
-     * @param currentTimeSeconds The current time in seconds, used to check the update interval.
+     * @brief Entity pool usage of the pipeline worker, for the diagnostics panel
      */
-    static void UpdateESPData(const FrameContext& context, float currentTimeSeconds);
+    static PipelinePoolStats GetPoolStats();
+
+    /**
+     * @brief Frustum cull counters of the pipeline worker's last update, for the diagnostics panel
+     */
+    static FrustumCullStats GetCullStats();
+
+private:
+    static bool ShouldHideESP(const MumbleLinkData* mumbleData);
 
     static Camera* s_camera; // Camera reference for world-to-screen projections
 };
 
 } // namespace kx
-
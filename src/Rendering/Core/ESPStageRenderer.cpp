@@ -4,6 +4,7 @@
 #include "../../Core/AppState.h"
 #include "../../Game/Camera.h"
 #include "../Utils/ESPMath.h"
+#include "../Utils/ScreenProjection.h"
 #include "../Utils/ESPStyling.h"
 #include "../Utils/CombatConstants.h"
 #include "../Utils/LayoutConstants.h"
@@ -20,6 +21,7 @@
 #include "../Utils/ESPFormatting.h"
 #include "../Renderers/TextRenderer.h"
 #include <optional>
+#include <span>
 #include <vector>
 #include <string>
 #include <map>
@@ -43,12 +45,8 @@ namespace {
     }
 }
 
-std::optional<VisualProperties> ESPStageRenderer::CalculateLiveVisuals(const FinalizedRenderable& item, const FrameContext& context) {
-    // 1. Re-project the entity's world position to get a fresh screen position.
-    glm::vec2 freshScreenPos;
-    if (!ESPMath::WorldToScreen(item.entity->position, context.camera, context.screenWidth, context.screenHeight, freshScreenPos)) {
-        return std::nullopt; // Cull if off-screen this frame.
-    }
+VisualProperties ESPStageRenderer::CalculateLiveVisuals(const FinalizedRenderable& item, const glm::vec2& freshScreenPos) {
+    // 1. The entity's world position was re-projected for this frame by RenderFrameData.
 
     // 2. Make a mutable copy of the cached visual properties.
     VisualProperties liveVisuals = item.visuals;
@@ -78,23 +76,40 @@ std::optional<VisualProperties> ESPStageRenderer::CalculateLiveVisuals(const Fin
 }
 
 void ESPStageRenderer::RenderFrameData(const FrameContext& context, const PooledFrameRenderData& frameData) {
-    for (const auto& item : frameData.finalizedEntities) {
-        
+    // Re-project every entity for this frame in one batched pass
+    thread_local std::vector<glm::vec3> positions;
+    thread_local std::vector<glm::vec2> screenPositions;
+    thread_local std::vector<uint8_t> visible;
+    const size_t count = frameData.finalizedEntities.size();
+    positions.resize(count);
+    screenPositions.resize(count);
+    visible.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        positions[i] = frameData.finalizedEntities[i].entity->position;
+    }
+    ScreenProjection::ProjectPoints(context.camera.GetViewProjectionMatrix(), positions,
+                                    context.screenWidth, context.screenHeight, screenPositions.data(), visible.data());
+
+    for (size_t i = 0; i < count; ++i) {
+        // Cull if off-screen this frame.
+        if (!visible[i]) {
+            continue;
+        }
+        const FinalizedRenderable& item = frameData.finalizedEntities[i];
+
         // First, perform the high-frequency update to get live visual properties for this frame.
-        auto liveVisualsOpt = CalculateLiveVisuals(item, context);
-        
-        // If the entity is on-screen, proceed with rendering.
-        if (liveVisualsOpt) {
-            // Use the pre-built context from the finalized renderable.
-            EntityRenderContext entityContext = item.context;
-            
-            // Render using the fresh visual properties.
-            RenderEntityComponents(context, entityContext, *liveVisualsOpt);
-            
-            // Render movement trail for players
-            if (entityContext.entityType == ESPEntityType::Player) {
-                ESPTrailRenderer::RenderPlayerTrail(context, entityContext, *liveVisualsOpt);
-            }
+        const VisualProperties liveVisuals = CalculateLiveVisuals(item, screenPositions[i]);
+
+        // Use the pre-built context from the finalized renderable.
+        EntityRenderContext entityContext = item.context;
+
+        // Render using the fresh visual properties.
+        RenderEntityComponents(context, entityContext, liveVisuals);
+
+        // Render movement trail for players
+        if (entityContext.entityType == ESPEntityType::Player) {
+            std::span<const PositionHistoryPoint> history(frameData.trailHistory.data() + item.trailOffset, item.trailCount);
+            ESPTrailRenderer::RenderPlayerTrail(context, entityContext, liveVisuals, history);
         }
     }
 }
@@ -149,7 +164,7 @@ void ESPStageRenderer::RenderStatusBars(
         glm::vec2 position = layout.GetElementPosition(LayoutElementKey::HealthBar);
         glm::vec2 topLeft = { position.x - props.finalHealthBarWidth / 2.0f, position.y };
         ESPHealthBarRenderer::RenderStandaloneHealthBar(context.drawList, topLeft, entityContext,
-            props.fadedEntityColor, props.finalHealthBarWidth, props.finalHealthBarHeight, props.finalFontSize);
+            props.fadedEntityColor, props.finalHealthBarWidth, props.finalHealthBarHeight, props.finalFontSize, context.settings.appearance.globalOpacity);
     }
 
     // Energy Bar (Players only)
@@ -160,7 +175,8 @@ void ESPStageRenderer::RenderStatusBars(
             glm::vec2 position = layout.GetElementPosition(LayoutElementKey::EnergyBar);
             glm::vec2 topLeft = { position.x - props.finalHealthBarWidth / 2.0f, position.y };
             ESPHealthBarRenderer::RenderStandaloneEnergyBar(context.drawList, topLeft, energyPercent,
-                props.finalAlpha, props.finalHealthBarWidth, props.finalHealthBarHeight, props.finalHealthBarHeight);
+                props.finalAlpha, props.finalHealthBarWidth, props.finalHealthBarHeight, props.finalHealthBarHeight,
+                context.settings.appearance.globalOpacity);
         }
     }
 }
@@ -173,7 +189,7 @@ void ESPStageRenderer::RenderPlayerIdentity(
 {
     // Player Name (fallback to profession if name is empty)
     if (entityContext.renderPlayerName) {
-        std::string displayName = entityContext.playerName;
+        std::string displayName(entityContext.playerName);
         
         // Fallback to profession for hostile players without names (WvW)
         if (displayName.empty() && entityContext.entityType == ESPEntityType::Player) {
@@ -227,9 +243,9 @@ void ESPStageRenderer::RenderEntityDetails(
     const LayoutResult& layout)
 {
     // Entity Details
-    if (entityContext.renderDetails && !entityContext.details.empty() && layout.HasElement(LayoutElementKey::Details)) {
+    if (entityContext.renderDetails && !entityContext.GetDetails().empty() && layout.HasElement(LayoutElementKey::Details)) {
         glm::vec2 position = layout.GetElementPosition(LayoutElementKey::Details);
-        ESPTextRenderer::RenderDetailsTextAt(context.drawList, position, entityContext.details, props.finalAlpha, props.finalFontSize);
+        ESPTextRenderer::RenderDetailsTextAt(context.drawList, position, entityContext.GetDetails(), props.finalAlpha, props.finalFontSize);
     }
 }
 
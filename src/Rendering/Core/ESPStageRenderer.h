@@ -23,7 +23,7 @@ public:
 
 private:
     static void RenderEntityComponents(const FrameContext& context, EntityRenderContext& entityContext, const VisualProperties& props);
-    static std::optional<VisualProperties> CalculateLiveVisuals(const FinalizedRenderable& item, const FrameContext& context);
+    static VisualProperties CalculateLiveVisuals(const FinalizedRenderable& item, const glm::vec2& freshScreenPos);
 
     /**
      * @brief Renders all elements that are part of the dynamic layout system.
@@ -5,59 +5,44 @@
 
 namespace kx {
 
+namespace {
+    // Screen position per filtered row, reused across updates (pipeline thread only)
+    struct ProjectedRow {
+        glm::vec2 screenPos;
+        bool onScreen;
+    };
+    std::vector<ProjectedRow> s_projectedRows;
+}
+
 void ESPVisualsProcessor::Process(const FrameContext& context, 
                                   const PooledFrameRenderData& filteredData,
                                   PooledFrameRenderData& outData) {
-    outData.finalizedEntities.clear();
-    outData.finalizedEntities.reserve(
-        filteredData.players.size() + filteredData.npcs.size() + filteredData.gadgets.size() + filteredData.attackTargets.size()
-    );
-
-    // Process players
-    for (const auto* entity : filteredData.players) {
-        if (!entity) continue;
-
-        auto visualPropsOpt = EntityVisualsCalculator::Calculate(*entity, context.camera, context.screenWidth, context.screenHeight);
-        
-        if (visualPropsOpt) {
-            EntityRenderContext renderContext = ESPContextFactory::CreateEntityRenderContextForRendering(entity, context);
-            outData.finalizedEntities.emplace_back(FinalizedRenderable{entity, *visualPropsOpt, renderContext});
-        }
-    }
-
-    // Process NPCs
-    for (const auto* entity : filteredData.npcs) {
-        if (!entity) continue;
+    const EntityTable& table = filteredData.table;
+    const size_t rowCount = table.Size();
 
-        auto visualPropsOpt = EntityVisualsCalculator::Calculate(*entity, context.camera, context.screenWidth, context.screenHeight);
-        
-        if (visualPropsOpt) {
-            EntityRenderContext renderContext = ESPContextFactory::CreateEntityRenderContextForRendering(entity, context);
-            outData.finalizedEntities.emplace_back(FinalizedRenderable{entity, *visualPropsOpt, renderContext});
-        }
-    }
-
-    // Process gadgets
-    for (const auto* entity : filteredData.gadgets) {
-        if (!entity) continue;
-
-        auto visualPropsOpt = EntityVisualsCalculator::Calculate(*entity, context.camera, context.screenWidth, context.screenHeight);
-        
-        if (visualPropsOpt) {
-            EntityRenderContext renderContext = ESPContextFactory::CreateEntityRenderContextForRendering(entity, context);
-            outData.finalizedEntities.emplace_back(FinalizedRenderable{entity, *visualPropsOpt, renderContext});
-        }
+    outData.finalizedEntities.clear();
+    outData.finalizedEntities.reserve(rowCount);
+
+    // Project the position column first, so off-screen entities never pull their renderable into cache
+    s_projectedRows.resize(rowCount);
+    for (size_t i = 0; i < rowCount; ++i) {
+        ProjectedRow& row = s_projectedRows[i];
+        row.onScreen = EntityVisualsCalculator::IsEntityOnScreen(table.positions[i], context.camera,
+                                                                 context.screenWidth, context.screenHeight, row.screenPos);
     }
 
-    // Process attack targets
-    for (const auto* entity : filteredData.attackTargets) {
-        if (!entity) continue;
+    // Rows are in list order (players, NPCs, gadgets, attack targets), which is also the draw order
+    for (size_t i = 0; i < rowCount; ++i) {
+        if (!s_projectedRows[i].onScreen) continue;
 
-        auto visualPropsOpt = EntityVisualsCalculator::Calculate(*entity, context.camera, context.screenWidth, context.screenHeight);
+        const RenderableEntity* entity = table.entities[i];
+        auto visualPropsOpt = EntityVisualsCalculator::Calculate(*entity, s_projectedRows[i].screenPos,
+                                                                 context.camera, context.screenWidth, context.screenHeight,
+                                                                 context.settings);
         
         if (visualPropsOpt) {
             EntityRenderContext renderContext = ESPContextFactory::CreateEntityRenderContextForRendering(entity, context);
-            outData.finalizedEntities.emplace_back(FinalizedRenderable{entity, *visualPropsOpt, renderContext});
+            outData.finalizedEntities.emplace_back(FinalizedRenderable{entity, *visualPropsOpt, std::move(renderContext)});
         }
     }
 }
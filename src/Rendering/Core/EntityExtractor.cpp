@@ -1,9 +1,8 @@
 #include "EntityExtractor.h"
+#include "EntityRefreshSchedule.h"
 #include "../Utils/ESPConstants.h"
 #include "../Utils/ESPFormatting.h"
 #include "../../Game/GameEnums.h"
-#include "../../Utils/StringHelpers.h"
-#include <vector>
 
 namespace kx {
 
@@ -21,14 +20,59 @@ namespace PhysicsValidation {
     constexpr float WIDTH_TO_HEIGHT_RATIO = 0.35f;  // 35% - typical humanoid/object proportions
 }
 
+    // Per-character refresh schedule for warm and cold fields (extraction thread only)
+    static EntityRefreshSchedule s_refreshSchedule;
+
+    // Replaces s_refreshSchedule on threads inside a ScopedRefreshSchedule
+    static thread_local EntityRefreshSchedule* t_scheduleOverride = nullptr;
+
+    // The schedule extractions on this thread read and update
+    static EntityRefreshSchedule& ActiveSchedule() {
+        return t_scheduleOverride ? *t_scheduleOverride : s_refreshSchedule;
+    }
+
+    EntityExtractor::ScopedRefreshSchedule::ScopedRefreshSchedule(EntityRefreshSchedule& schedule)
+        : m_previous(t_scheduleOverride) {
+        t_scheduleOverride = &schedule;
+    }
+
+    EntityExtractor::ScopedRefreshSchedule::~ScopedRefreshSchedule() {
+        t_scheduleOverride = m_previous;
+    }
+
+    void EntityExtractor::BeginUpdate() {
+        s_refreshSchedule.BeginUpdate();
+    }
+
+    void EntityExtractor::EndUpdate() {
+        s_refreshSchedule.EndUpdate();
+    }
+
+    void EntityExtractor::InvalidateCachedFields() {
+        s_refreshSchedule.RequestInvalidateAll();
+    }
+
+    FieldRefreshStats EntityExtractor::GetFieldRefreshStats() {
+        return s_refreshSchedule.GetStats();
+    }
+
     bool EntityExtractor::ExtractPlayer(RenderablePlayer& outPlayer,
         const ReClass::ChCliCharacter& inCharacter,
-        const wchar_t* playerName,
+        StringHandle playerName,
         void* localPlayerPtr) {
 
-        // --- Validation and Position ---
+        EntityRefreshSchedule& schedule = ActiveSchedule();
+        CharacterFieldCache& cache = schedule.Touch(inCharacter.data());
+
+        // --- Validation and Position (cached chains, walked again with the warm tier) ---
+        // Resolving may find another character at this address and reset the entry, so the
+        // tiers are only decided afterwards
         glm::vec3 gamePos;
-        if (!ValidateAndExtractGamePosition(inCharacter, gamePos)) return false;
+        const bool rewalk = schedule.IsWarmDue(cache) || schedule.IsColdDue(cache) || !cache.playerFieldsValid;
+        if (!ResolveCharacterChains(cache, inCharacter, true, rewalk, gamePos)) return false;
+        const CharacterPointerChains& chains = cache.chains;
+        const bool coldDue = schedule.IsColdDue(cache) || !cache.playerFieldsValid;
+        const bool warmDue = schedule.IsWarmDue(cache);
 
         // --- Populate Core Data ---
         outPlayer.position = TransformGamePositionToMumble(gamePos);
@@ -36,62 +80,87 @@ namespace PhysicsValidation {
         outPlayer.entityType = ESPEntityType::Player;
         outPlayer.address = inCharacter.data();
         outPlayer.isLocalPlayer = (outPlayer.address == localPlayerPtr);
-        if (playerName) {
-            outPlayer.playerName = StringHelpers::WCharToUTF8String(playerName);
-        }
+        outPlayer.playerName = playerName;
 
-        // --- Agent Info ---
-        ReClass::AgChar agent = inCharacter.GetAgent();
-        if (agent) {
-            outPlayer.agentType = agent.GetType();
-            outPlayer.agentId = agent.GetId();
-        }
-
-        // --- Health & Energy ---
-        ReClass::ChCliHealth health = inCharacter.GetHealth();
-        ExtractHealthData(outPlayer, health);
+        // --- Health & Energy (hot: every update, one load per leaf) ---
+        bool leavesReadable = ExtractHealthData(outPlayer, ReClass::ChCliHealth(chains.health)) || !chains.health;
 
         // Dodge Energy
-        ReClass::ChCliEnergies energies = inCharacter.GetEnergies();
-        if (energies) {
-            outPlayer.currentEnergy = energies.GetCurrent();
-            outPlayer.maxEnergy = energies.GetMax();
+        const ReClass::ChCliEnergies::Snapshot energies = ReClass::ChCliEnergies(chains.energies).ReadSnapshot();
+        if (energies.valid) {
+            outPlayer.currentEnergy = energies.current;
+            outPlayer.maxEnergy = energies.max;
         }
+        leavesReadable &= energies.valid || !chains.energies;
 
         // Special Energy
-        ReClass::ChCliSpecialEnergies specialEnergies = inCharacter.GetSpecialEnergies();
-        if (specialEnergies) {
-            outPlayer.currentSpecialEnergy = specialEnergies.GetCurrent();
-            outPlayer.maxSpecialEnergy = specialEnergies.GetMax();
+        const ReClass::ChCliSpecialEnergies::Snapshot specialEnergies = ReClass::ChCliSpecialEnergies(chains.specialEnergies).ReadSnapshot();
+        if (specialEnergies.valid) {
+            outPlayer.currentSpecialEnergy = specialEnergies.current;
+            outPlayer.maxSpecialEnergy = specialEnergies.max;
         }
+        leavesReadable &= specialEnergies.valid || !chains.specialEnergies;
 
-        // --- Core Stats ---
-        ReClass::ChCliCoreStats coreStats = inCharacter.GetCoreStats();
-        if (coreStats) {
-            outPlayer.level = coreStats.GetLevel();
-            outPlayer.scaledLevel = coreStats.GetScaledLevel();
-            outPlayer.profession = coreStats.GetProfession();
-            outPlayer.attitude = inCharacter.GetAttitude();
-            outPlayer.race = coreStats.GetRace();
+        // A leaf that no longer reads is stale: walk every chain again next update
+        if (!leavesReadable) {
+            cache.chains.valid = false;
         }
 
-        // --- Gear ---
-        ReClass::Inventory inventory = inCharacter.GetInventory();
-        if (inventory) {
-            ExtractGear(outPlayer, inventory);
+        // Core stats feed both the cold and the warm tier; copy them once if either is due
+        ReClass::ChCliCoreStats::Snapshot coreStats;
+        if (coldDue || warmDue) {
+            coreStats = inCharacter.GetCoreStats().ReadSnapshot();
         }
-        
-        // --- Physics Box Shape Dimensions ---
-        ExtractBoxShapeDimensions(outPlayer, inCharacter);
+
+        // --- Agent Info, Profession, Race, Physics (cold: first sight or invalidation) ---
+        if (coldDue) {
+            RefreshCharacterColdFields(cache, inCharacter);
+
+            if (coreStats.valid) {
+                cache.profession = coreStats.profession;
+                cache.race = coreStats.race;
+            }
+            cache.playerFieldsValid = true;
+            schedule.MarkColdRefreshed(cache);
+        } else {
+            schedule.RecordColdSkipped(FieldRefresh::CHARACTER_COLD_FIELD_READS + FieldRefresh::PLAYER_COLD_FIELD_READS);
+        }
+
+        // --- Gear (only when the equipment changed) ---
+        RefreshGear(cache);
+
+        // --- Level, Attitude (warm: every few updates) ---
+        if (warmDue) {
+            if (coreStats.valid) {
+                cache.level = coreStats.level;
+                cache.scaledLevel = coreStats.scaledLevel;
+                cache.attitude = inCharacter.GetAttitude();
+            }
+            schedule.MarkWarmRefreshed(cache);
+        } else {
+            schedule.RecordWarmSkipped(FieldRefresh::WARM_FIELD_READS);
+        }
+
+        ApplyCachedCharacterFields(outPlayer, cache);
+        outPlayer.level = cache.level;
+        outPlayer.scaledLevel = cache.scaledLevel;
+        outPlayer.attitude = cache.attitude;
+        outPlayer.profession = cache.profession;
+        outPlayer.race = cache.race;
+        outPlayer.gear = cache.gear;
 
         return true;
     }
 
     bool EntityExtractor::ExtractNpc(RenderableNpc& outNpc, const ReClass::ChCliCharacter& inCharacter) {
 
-        // --- Validation and Position ---
+        EntityRefreshSchedule& schedule = ActiveSchedule();
+        CharacterFieldCache& cache = schedule.Touch(inCharacter.data());
+
+        // --- Validation and Position (cached chains, walked again with the warm tier) ---
+        // The tiers below are decided after resolving, which resets the entry for a new character
         glm::vec3 gamePos;
-        if (!ValidateAndExtractGamePosition(inCharacter, gamePos)) return false;
+        if (!ResolveCharacterChains(cache, inCharacter, false, schedule.IsWarmDue(cache) || schedule.IsColdDue(cache), gamePos)) return false;
 
         // --- Populate Core Data ---
         outNpc.position = TransformGamePositionToMumble(gamePos);
@@ -99,27 +168,36 @@ namespace PhysicsValidation {
         outNpc.entityType = ESPEntityType::NPC;
         outNpc.address = inCharacter.data();
 
-        // --- Agent Info ---
-        ReClass::AgChar agent = inCharacter.GetAgent();
-        if (agent) {
-            outNpc.agentType = agent.GetType();
-            outNpc.agentId = agent.GetId();
+        // --- Health (hot: every update, one load through the cached leaf) ---
+        if (!ExtractHealthData(outNpc, ReClass::ChCliHealth(cache.chains.health)) && cache.chains.health) {
+            cache.chains.valid = false;
         }
 
-        // --- Health ---
-        ReClass::ChCliHealth health = inCharacter.GetHealth();
-        ExtractHealthData(outNpc, health);
+        // --- Agent Info, Physics (cold: first sight or invalidation) ---
+        if (schedule.IsColdDue(cache)) {
+            RefreshCharacterColdFields(cache, inCharacter);
+            schedule.MarkColdRefreshed(cache);
+        } else {
+            schedule.RecordColdSkipped(FieldRefresh::CHARACTER_COLD_FIELD_READS);
+        }
 
-        // --- Stats ---
-        ReClass::ChCliCoreStats coreStats = inCharacter.GetCoreStats();
-        if (coreStats) {
-            outNpc.level = coreStats.GetLevel();
+        // --- Level, Attitude, Rank (warm: every few updates) ---
+        if (schedule.IsWarmDue(cache)) {
+            const ReClass::ChCliCoreStats::Snapshot coreStats = inCharacter.GetCoreStats().ReadSnapshot();
+            if (coreStats.valid) {
+                cache.level = coreStats.level;
+            }
+            cache.attitude = inCharacter.GetAttitude();
+            cache.rank = inCharacter.GetRank();
+            schedule.MarkWarmRefreshed(cache);
+        } else {
+            schedule.RecordWarmSkipped(FieldRefresh::WARM_FIELD_READS);
         }
-        outNpc.attitude = inCharacter.GetAttitude();
-        outNpc.rank = inCharacter.GetRank();
-        
-        // --- Physics Box Shape Dimensions ---
-        ExtractBoxShapeDimensions(outNpc, inCharacter);
+
+        ApplyCachedCharacterFields(outNpc, cache);
+        outNpc.level = cache.level;
+        outNpc.attitude = cache.attitude;
+        outNpc.rank = cache.rank;
 
         return true;
     }
@@ -195,20 +273,51 @@ namespace PhysicsValidation {
         return true;
     }
 
-    void EntityExtractor::ExtractGear(RenderablePlayer& outPlayer, const ReClass::Inventory& inventory) {
-        outPlayer.gear.clear();
+    void EntityExtractor::RefreshGear(CharacterFieldCache& cache) {
+        EntityRefreshSchedule& schedule = ActiveSchedule();
+        ReClass::Inventory inventory(cache.chains.inventory);
+        ReClass::EquipSlotTable slotTable{};
+        if (!inventory || !inventory.ReadEquipSlotTable(slotTable)) {
+            cache.gear = {};
+            cache.gearFingerprint = 0;
+            cache.gearValid = true;
+            return;
+        }
+
+        const uint64_t fingerprint = ComputeGearFingerprint(inventory.data(), slotTable);
+        if (cache.gearValid && cache.gearFingerprint == fingerprint) {
+            schedule.RecordGearSkipped(GearLayout::SLOT_COUNT * FieldRefresh::GEAR_READS_PER_SLOT -
+                                                FieldRefresh::GEAR_FINGERPRINT_READS);
+            return;
+        }
+
+        ExtractGear(cache.gear, slotTable);
+        cache.gearFingerprint = fingerprint;
+        cache.gearValid = true;
+    }
 
-        const std::vector<Game::EquipmentSlot> slotsToCheck = {
-            Game::EquipmentSlot::Helm, Game::EquipmentSlot::Shoulders, Game::EquipmentSlot::Chest,
-            Game::EquipmentSlot::Gloves, Game::EquipmentSlot::Pants, Game::EquipmentSlot::Boots,
-            Game::EquipmentSlot::Back, Game::EquipmentSlot::Amulet, Game::EquipmentSlot::Accessory1,
-            Game::EquipmentSlot::Accessory2, Game::EquipmentSlot::Ring1, Game::EquipmentSlot::Ring2,
-            Game::EquipmentSlot::MainhandWeapon1, Game::EquipmentSlot::OffhandWeapon1,
-            Game::EquipmentSlot::MainhandWeapon2, Game::EquipmentSlot::OffhandWeapon2
+    uint64_t EntityExtractor::ComputeGearFingerprint(const void* inventory, const ReClass::EquipSlotTable& slotTable) {
+        // FNV-1a over the inventory address and the slot pointers we inspect; equipping,
+        // swapping or removing an item replaces the slot's pointer
+        uint64_t hash = 0xcbf29ce484222325ull;
+        auto mix = [&hash](uintptr_t value) {
+            hash ^= value;
+            hash *= 0x100000001b3ull;
         };
 
-        for (const auto& slotEnum : slotsToCheck) {
-            ReClass::EquipSlot slot = inventory.GetEquipSlot(static_cast<int>(slotEnum));
+        mix(reinterpret_cast<uintptr_t>(inventory));
+        for (const auto slotEnum : GearLayout::SLOTS) {
+            mix(reinterpret_cast<uintptr_t>(slotTable[static_cast<size_t>(slotEnum)]));
+        }
+        return hash;
+    }
+
+    void EntityExtractor::ExtractGear(GearArray& outGear, const ReClass::EquipSlotTable& slotTable) {
+        outGear = {};
+
+        for (size_t i = 0; i < GearLayout::SLOT_COUNT; ++i) {
+            const Game::EquipmentSlot slotEnum = GearLayout::SLOTS[i];
+            ReClass::EquipSlot slot(slotTable[static_cast<size_t>(slotEnum)]);
             if (!slot) continue;
 
             ReClass::ItemDef itemDef = slot.GetItemDefinition();
@@ -227,21 +336,82 @@ namespace PhysicsValidation {
                 if (stat) slotInfo.statId = stat.GetId();
             }
 
-        outPlayer.gear[slotEnum] = slotInfo;
+        outGear[i] = slotInfo;
     }
 }
 
 // Helper method implementations
-bool EntityExtractor::ValidateAndExtractGamePosition(const ReClass::ChCliCharacter& character, glm::vec3& outGamePos) {
+void EntityExtractor::RefreshCharacterColdFields(CharacterFieldCache& cache, const ReClass::ChCliCharacter& character) {
+    ReClass::AgChar agent = character.GetAgent();
+    if (agent) {
+        cache.agentType = agent.GetType();
+        cache.agentId = agent.GetId();
+    }
+
+    RenderableEntity dimensions;
+    ExtractBoxShapeDimensions(dimensions, character);
+    cache.physicsWidth = dimensions.physicsWidth;
+    cache.physicsDepth = dimensions.physicsDepth;
+    cache.physicsHeight = dimensions.physicsHeight;
+    cache.hasPhysicsDimensions = dimensions.hasPhysicsDimensions;
+}
+
+void EntityExtractor::ApplyCachedCharacterFields(RenderableEntity& entity, const CharacterFieldCache& cache) {
+    entity.agentType = cache.agentType;
+    entity.agentId = cache.agentId;
+    entity.physicsWidth = cache.physicsWidth;
+    entity.physicsDepth = cache.physicsDepth;
+    entity.physicsHeight = cache.physicsHeight;
+    entity.hasPhysicsDimensions = cache.hasPhysicsDimensions;
+}
+
+bool EntityExtractor::ResolveCharacterChains(CharacterFieldCache& cache, const ReClass::ChCliCharacter& character,
+    bool isPlayer, bool rewalk, glm::vec3& outGamePos) {
+    EntityRefreshSchedule& schedule = ActiveSchedule();
+    CharacterPointerChains& chains = cache.chains;
+
+    if (chains.valid && !rewalk) {
+        // Same agent pointer: still the same character. The CoChar leaf must still be a live
+        // object, and reading the position through it is guarded like any other read
+        void* agent = character.ReadMember<void*>(Offsets::ChCliCharacter::AGENT, nullptr);
+        if (agent == chains.agent && SafeAccess::IsVTablePointerValid(chains.coChar, VTableKind::CoChar)) {
+            outGamePos = ReClass::CoChar(chains.coChar).GetVisualPosition();
+            if (outGamePos.x != 0.0f || outGamePos.y != 0.0f || outGamePos.z != 0.0f) {
+                schedule.RecordChainsReused(FieldRefresh::CHARACTER_CHAIN_READS_SAVED +
+                                                     (isPlayer ? FieldRefresh::PLAYER_CHAIN_READS_SAVED : 0));
+                return true;
+            }
+        }
+        schedule.RecordChainsRewalked();
+    }
+
+    // Full walk from the character
+    chains = {};
     ReClass::AgChar agent = character.GetAgent();
     if (!agent) return false;
 
+    // Another agent behind the same character address is another character: nothing cached
+    // for the previous one applies, so every tier is read again as on first sight
+    if (cache.identityAgent && cache.identityAgent != agent.data()) {
+        schedule.ResetForNewCharacter(cache);
+    }
+    cache.identityAgent = agent.data();
+
     ReClass::CoChar coChar = agent.GetCoChar();
     if (!coChar) return false;
 
     outGamePos = coChar.GetVisualPosition();
     if (outGamePos.x == 0.0f && outGamePos.y == 0.0f && outGamePos.z == 0.0f) return false;
 
+    chains.agent = agent.data();
+    chains.coChar = coChar.data();
+    chains.health = character.GetHealth().data();
+    if (isPlayer) {
+        chains.energies = character.GetEnergies().data();
+        chains.specialEnergies = character.GetSpecialEnergies().data();
+        chains.inventory = character.GetInventory().data();
+    }
+    chains.valid = true;
     return true;
 }
 
@@ -278,12 +448,15 @@ glm::vec3 EntityExtractor::TransformGamePositionToMumble(const glm::vec3& gamePo
     );
 }
 
-void EntityExtractor::ExtractHealthData(RenderableEntity& entity, const ReClass::ChCliHealth& health) {
-    if (health) {
-        entity.currentHealth = health.GetCurrent();
-        entity.maxHealth = health.GetMax();
-        entity.currentBarrier = health.GetBarrier();
+bool EntityExtractor::ExtractHealthData(RenderableEntity& entity, const ReClass::ChCliHealth& health) {
+    // One copy of the struct, so current/max/barrier always belong to the same moment
+    const ReClass::ChCliHealth::Snapshot snapshot = health.ReadSnapshot();
+    if (snapshot.valid) {
+        entity.currentHealth = snapshot.current;
+        entity.maxHealth = snapshot.max;
+        entity.currentBarrier = snapshot.barrier;
     }
+    return snapshot.valid;
 }
 
 void EntityExtractor::ExtractBoxShapeDimensions(RenderableEntity& entity, const ReClass::ChCliCharacter& character) {
@@ -5,23 +5,66 @@
 
 namespace kx {
 
+    struct CharacterFieldCache;
+    struct FieldRefreshStats;
+    class EntityRefreshSchedule;
+
     /**
      * @brief A static helper class that encapsulates the logic for extracting data
      *        for a single entity from game memory structures into a safe Renderable object.
      */
     class EntityExtractor {
     public:
+        /**
+         * @brief Advance the field refresh schedule. Call once before extracting an update.
+         */
+        static void BeginUpdate();
+
+        /**
+         * @brief Drop cached fields for characters not seen this update and publish counters.
+         */
+        static void EndUpdate();
+
+        /**
+         * @brief Force warm and cold fields of every character to be re-read on the next update.
+         * Safe to call from any thread.
+         */
+        static void InvalidateCachedFields();
+
+        /**
+         * @brief Counters for how many field reads the refresh schedule saved.
+         */
+        static FieldRefreshStats GetFieldRefreshStats();
+
+        /**
+         * @brief Routes the calling thread's extractions through another refresh schedule while in scope
+         *
+         * Test seam: tests extract through a schedule of their own, because the extraction
+         * workers use the shared one concurrently and EndUpdate() prunes it.
+         */
+        class ScopedRefreshSchedule {
+        public:
+            explicit ScopedRefreshSchedule(EntityRefreshSchedule& schedule);
+            ~ScopedRefreshSchedule();
+
+            ScopedRefreshSchedule(const ScopedRefreshSchedule&) = delete;
+            ScopedRefreshSchedule& operator=(const ScopedRefreshSchedule&) = delete;
+
+        private:
+            EntityRefreshSchedule* m_previous;
+        };
+
         /**
          * @brief Populates a RenderablePlayer object from a ChCliCharacter game structure.
          * @param outPlayer The RenderablePlayer object to populate (from an object pool).
          * @param inCharacter The source ChCliCharacter structure from the game.
-         * @param playerName The player's name, obtained from the player list.
+         * @param playerName The player's interned name from the PlayerNameCache.
          * @param localPlayerPtr A pointer to the local player's character object for comparison.
          * @return True if extraction was successful and the entity is valid, false otherwise.
          */
         static bool ExtractPlayer(RenderablePlayer& outPlayer,
             const ReClass::ChCliCharacter& inCharacter,
-            const wchar_t* playerName,
+            StringHandle playerName,
             void* localPlayerPtr);
 
         /**
@@ -52,19 +95,50 @@ namespace kx {
             const ReClass::AgentInl& inAgentInl);
 
     private:
+        /**
+         * @brief Re-read a player's gear if the inventory fingerprint changed since the last read.
+         * Uses the inventory pointer resolved by ResolveCharacterChains().
+         */
+        static void RefreshGear(CharacterFieldCache& cache);
+
+        /**
+         * @brief Cheap hash of the inventory address and the inspected equipment slot pointers.
+         */
+        static uint64_t ComputeGearFingerprint(const void* inventory, const ReClass::EquipSlotTable& slotTable);
+
         /**
          * @brief Helper to encapsulate the detailed gear extraction logic for a player.
-         * @param outPlayer The RenderablePlayer object to add gear information to.
-         * @param inventory The player's inventory structure from the game.
+         * @param outGear The gear array to fill (cleared first).
+         * @param slotTable The equipment slot pointers read from the player's inventory.
+         */
+        static void ExtractGear(GearArray& outGear, const ReClass::EquipSlotTable& slotTable);
+
+        /**
+         * @brief Re-read the cold fields shared by players and NPCs (agent info, physics dimensions).
+         */
+        static void RefreshCharacterColdFields(CharacterFieldCache& cache, const ReClass::ChCliCharacter& character);
+
+        /**
+         * @brief Copy cached agent info and physics dimensions onto a pooled entity.
+         */
+        static void ApplyCachedCharacterFields(RenderableEntity& entity, const CharacterFieldCache& cache);
+
+        /**
+         * @brief Resolve a character's hot leaf pointers (CoChar, health, energies, inventory) and read its position.
+         * Cached leaves are reused while the character's agent pointer is unchanged and the CoChar
+         * passes the vtable check; otherwise, or when rewalk is set, every chain is walked again.
+         * A walk that finds a different agent than the cached fields were read for resets the
+         * entry (another character now lives at this address), so decide the tiers afterwards.
+         * @return False if the character has no readable position.
          */
-        static void ExtractGear(RenderablePlayer& outPlayer, const ReClass::Inventory& inventory);
+        static bool ResolveCharacterChains(CharacterFieldCache& cache, const ReClass::ChCliCharacter& character,
+            bool isPlayer, bool rewalk, glm::vec3& outGamePos);
 
         // Common extraction pattern helpers
-        static bool ValidateAndExtractGamePosition(const ReClass::ChCliCharacter& character, glm::vec3& outGamePos);
         static bool ValidateAndExtractGamePosition(const ReClass::GdCliGadget& gadget, glm::vec3& outGamePos);
         static bool ValidateAndExtractGamePosition(const ReClass::AgKeyFramed& agKeyframed, glm::vec3& outGamePos);
         static glm::vec3 TransformGamePositionToMumble(const glm::vec3& gamePos);
-        static void ExtractHealthData(RenderableEntity& entity, const ReClass::ChCliHealth& health);
+        static bool ExtractHealthData(RenderableEntity& entity, const ReClass::ChCliHealth& health);
         
         /**
          * @brief Extract physics box shape dimensions from character
@@ -0,0 +1,123 @@
+#include "EntityRefreshSchedule.h"
+
+namespace kx {
+
+void EntityRefreshSchedule::BeginUpdate() {
+    ++m_updateIndex;
+    m_warmSkipped.store(0, std::memory_order_relaxed);
+    m_coldSkipped.store(0, std::memory_order_relaxed);
+    m_gearSkipped.store(0, std::memory_order_relaxed);
+    m_chainsReused.store(0, std::memory_order_relaxed);
+    m_chainsRewalked.store(0, std::memory_order_relaxed);
+    m_readsSaved.store(0, std::memory_order_relaxed);
+
+    if (m_invalidateAllRequested.exchange(false, std::memory_order_acq_rel)) {
+        for (auto& shard : m_shards) {
+            shard.entries.clear();
+        }
+    }
+}
+
+void EntityRefreshSchedule::EndUpdate() {
+    // Drop every character that was not seen this update
+    uint32_t tracked = 0;
+    for (auto& shard : m_shards) {
+        std::erase_if(shard.entries, [this](const auto& entry) {
+            return entry.second.lastSeenUpdate != m_updateIndex;
+        });
+        tracked += static_cast<uint32_t>(shard.entries.size());
+    }
+
+    const uint64_t readsSaved = m_readsSaved.load(std::memory_order_relaxed);
+    m_publishedTracked.store(tracked, std::memory_order_relaxed);
+    m_publishedWarmSkipped.store(m_warmSkipped.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_publishedColdSkipped.store(m_coldSkipped.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_publishedGearSkipped.store(m_gearSkipped.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_publishedChainsReused.store(m_chainsReused.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_publishedChainsRewalked.store(m_chainsRewalked.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_publishedReadsSaved.store(readsSaved, std::memory_order_relaxed);
+    m_publishedReadsSavedTotal.fetch_add(readsSaved, std::memory_order_relaxed);
+}
+
+EntityRefreshSchedule::Shard& EntityRefreshSchedule::ShardFor(const void* address) {
+    // Objects are at least 16-byte aligned, so skip the always-zero low bits
+    const uintptr_t bits = reinterpret_cast<uintptr_t>(address) >> 4;
+    return m_shards[(bits ^ (bits >> 7)) % FieldRefresh::SCHEDULE_SHARD_COUNT];
+}
+
+CharacterFieldCache& EntityRefreshSchedule::Touch(const void* address) {
+    Shard& shard = ShardFor(address);
+    std::lock_guard lock(shard.mutex);
+
+    auto [it, inserted] = shard.entries.try_emplace(address);
+    CharacterFieldCache& entry = it->second;
+    if (inserted) {
+        // Stagger warm refreshes by address so they don't all land on the same update
+        entry.warmPhase = (reinterpret_cast<uintptr_t>(address) >> 4) % FieldRefresh::WARM_REFRESH_INTERVAL_UPDATES;
+    }
+    entry.lastSeenUpdate = m_updateIndex;
+    return entry;
+}
+
+bool EntityRefreshSchedule::IsWarmDue(const CharacterFieldCache& entry) const {
+    return !entry.warmValid || (m_updateIndex - entry.lastWarmRefresh) >= FieldRefresh::WARM_REFRESH_INTERVAL_UPDATES;
+}
+
+void EntityRefreshSchedule::ResetForNewCharacter(CharacterFieldCache& entry) {
+    // Keep only the bookkeeping that belongs to the address
+    const uint64_t lastSeenUpdate = entry.lastSeenUpdate;
+    const uint64_t warmPhase = entry.warmPhase;
+    entry = CharacterFieldCache{};
+    entry.lastSeenUpdate = lastSeenUpdate;
+    entry.warmPhase = warmPhase;
+}
+
+void EntityRefreshSchedule::MarkWarmRefreshed(CharacterFieldCache& entry) {
+    entry.warmValid = true;
+    // Record the start of the character's slot rather than this update, so a refresh taken
+    // off-slot (first sight) still leaves the next one on the character's own phase
+    entry.lastWarmRefresh = m_updateIndex - (m_updateIndex + entry.warmPhase) % FieldRefresh::WARM_REFRESH_INTERVAL_UPDATES;
+}
+
+void EntityRefreshSchedule::MarkColdRefreshed(CharacterFieldCache& entry) {
+    entry.coldValid = true;
+}
+
+void EntityRefreshSchedule::RecordWarmSkipped(uint32_t readsSaved) {
+    m_warmSkipped.fetch_add(1, std::memory_order_relaxed);
+    m_readsSaved.fetch_add(readsSaved, std::memory_order_relaxed);
+}
+
+void EntityRefreshSchedule::RecordColdSkipped(uint32_t readsSaved) {
+    m_coldSkipped.fetch_add(1, std::memory_order_relaxed);
+    m_readsSaved.fetch_add(readsSaved, std::memory_order_relaxed);
+}
+
+void EntityRefreshSchedule::RecordGearSkipped(uint32_t readsSaved) {
+    m_gearSkipped.fetch_add(1, std::memory_order_relaxed);
+    m_readsSaved.fetch_add(readsSaved, std::memory_order_relaxed);
+}
+
+void EntityRefreshSchedule::RecordChainsReused(uint32_t readsSaved) {
+    m_chainsReused.fetch_add(1, std::memory_order_relaxed);
+    m_readsSaved.fetch_add(readsSaved, std::memory_order_relaxed);
+}
+
+void EntityRefreshSchedule::RecordChainsRewalked() {
+    m_chainsRewalked.fetch_add(1, std::memory_order_relaxed);
+}
+
+FieldRefreshStats EntityRefreshSchedule::GetStats() const {
+    FieldRefreshStats stats;
+    stats.trackedEntities = m_publishedTracked.load(std::memory_order_relaxed);
+    stats.warmSkipped = m_publishedWarmSkipped.load(std::memory_order_relaxed);
+    stats.coldSkipped = m_publishedColdSkipped.load(std::memory_order_relaxed);
+    stats.gearSkipped = m_publishedGearSkipped.load(std::memory_order_relaxed);
+    stats.chainsReused = m_publishedChainsReused.load(std::memory_order_relaxed);
+    stats.chainsRewalked = m_publishedChainsRewalked.load(std::memory_order_relaxed);
+    stats.readsSavedLastUpdate = m_publishedReadsSaved.load(std::memory_order_relaxed);
+    stats.readsSavedTotal = m_publishedReadsSavedTotal.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace kx
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ankerl/unordered_dense.h>
+#include "../../Game/GameEnums.h"
+#include "../Data/PlayerRenderData.h"
+
+namespace kx {
+
+/**
+ * @brief Refresh tier configuration for per-entity field extraction
+ *
+ * Hot fields (position, health, barrier, energy) are read every update.
+ * Warm fields (attitude, level, rank) are read every WARM_REFRESH_INTERVAL_UPDATES.
+ * Cold fields (agent info, race, profession, physics dimensions) are read on
+ * first sight and again only after an explicit invalidation.
+ * Gear is re-read only when the inventory fingerprint (inventory pointer plus the
+ * equipment slot pointers, fetched in one guarded read) changes.
+ * Pointer chains (character -> AgChar -> CoChar, character -> health/energies/inventory)
+ * are walked once and their leaves reused while the character still points at the same
+ * agent; they are walked again with every warm refresh and whenever a leaf fails its check.
+ */
+namespace FieldRefresh {
+    constexpr uint64_t WARM_REFRESH_INTERVAL_UPDATES = 16;
+
+    // Approximate validated reads performed by each tier, used for the "reads saved" counters
+    constexpr uint32_t WARM_FIELD_READS = 4;             // Core stats pointer, level/scaled level, attitude, rank
+    constexpr uint32_t CHARACTER_COLD_FIELD_READS = 7;   // Agent type/id, AgChar -> CoChar -> wrapper -> box shape -> height
+    constexpr uint32_t PLAYER_COLD_FIELD_READS = 3;      // Core stats pointer, profession, race
+    constexpr uint32_t GEAR_READS_PER_SLOT = 5;          // Slot, item definition, item id, rarity, stat
+    constexpr uint32_t GEAR_FINGERPRINT_READS = 2;       // Inventory pointer, equipment slot table
+    constexpr uint32_t CHARACTER_CHAIN_READS_SAVED = 2;  // CoChar and health pointers
+    constexpr uint32_t PLAYER_CHAIN_READS_SAVED = 3;     // Energies, special energies and inventory pointers
+
+    // Entries are split across independently locked shards so extraction workers rarely contend
+    constexpr size_t SCHEDULE_SHARD_COUNT = 16;
+}
+
+/**
+ * @brief Leaf pointers resolved from one character, reused across updates
+ *
+ * agent is kept only as an identity check: the character's agent pointer is re-read every
+ * update (one load from the character itself), and a different value means the address
+ * now holds another character, so every leaf is resolved again.
+ */
+struct CharacterPointerChains {
+    void* agent = nullptr;            // character -> AgChar
+    void* coChar = nullptr;           // character -> AgChar -> CoChar
+    void* health = nullptr;           // character -> ChCliHealth
+    void* energies = nullptr;         // character -> ChCliEnergies (players)
+    void* specialEnergies = nullptr;  // character -> ChCliSpecialEnergies (players)
+    void* inventory = nullptr;        // character -> Inventory (players)
+    bool valid = false;
+};
+
+/**
+ * @brief Cached warm and cold fields for one character, keyed by character address
+ */
+struct CharacterFieldCache {
+    uint64_t lastSeenUpdate = 0;
+    uint64_t lastWarmRefresh = 0;
+    uint64_t warmPhase = 0;          // Offset of this character's warm refresh slot within the interval
+    const void* identityAgent = nullptr; // Agent the cached fields were read for; another agent is another character
+    bool warmValid = false;
+    bool coldValid = false;
+    bool playerFieldsValid = false;  // Profession, race and gear were read (character was seen as a player)
+
+    // Warm tier
+    uint32_t level = 0;
+    uint32_t scaledLevel = 0;
+    Game::Attitude attitude = Game::Attitude::Neutral;
+    Game::CharacterRank rank = Game::CharacterRank::Normal;
+
+    // Cold tier
+    Game::AgentType agentType = Game::AgentType::Error;
+    int32_t agentId = 0;
+    Game::Profession profession = Game::Profession::None;
+    Game::Race race = Game::Race::None;
+    float physicsWidth = 0.0f;
+    float physicsDepth = 0.0f;
+    float physicsHeight = 0.0f;
+    bool hasPhysicsDimensions = false;
+
+    // Gear (players only), refreshed when the inventory fingerprint changes
+    GearArray gear{};
+    uint64_t gearFingerprint = 0;
+    bool gearValid = false;
+
+    // Hot tier pointer chains
+    CharacterPointerChains chains;
+};
+
+/**
+ * @brief Snapshot of the field refresh counters for diagnostics
+ */
+struct FieldRefreshStats {
+    uint32_t trackedEntities = 0;
+    uint32_t warmSkipped = 0;          // Entities whose warm tier was served from cache last update
+    uint32_t coldSkipped = 0;          // Entities whose cold tier was served from cache last update
+    uint32_t gearSkipped = 0;          // Players whose gear fingerprint was unchanged last update
+    uint32_t chainsReused = 0;         // Characters whose cached pointer chains were reused last update
+    uint32_t chainsRewalked = 0;       // Characters whose cached chains failed a check last update
+    uint64_t readsSavedLastUpdate = 0;
+    uint64_t readsSavedTotal = 0;
+};
+
+/**
+ * @brief Per-entity refresh schedule deciding which field tiers to re-read each update
+ *
+ * Entries live for as long as the character keeps appearing in the character list;
+ * any entry not seen during an update is dropped in EndUpdate(), so a recycled
+ * address always starts with a full read. An address taken over by another character
+ * within one update is caught by its agent pointer and reset (ResetForNewCharacter).
+ *
+ * BeginUpdate()/EndUpdate() are called by the pipeline thread while no extraction is in
+ * flight. In between, Touch() and the Record*() counters may be called concurrently by
+ * the extraction workers: entries live in address-sharded segmented maps (references
+ * stay valid across inserts), and each character is visited by exactly one worker per
+ * update, so the returned entry can be used without holding the shard lock.
+ * GetStats() and RequestInvalidateAll() may be called from any thread.
+ */
+class EntityRefreshSchedule {
+public:
+    void BeginUpdate();
+    void EndUpdate();
+
+    /**
+     * @brief Get (or create) the cache entry for a character and mark it as seen this update
+     * Thread-safe between BeginUpdate() and EndUpdate().
+     */
+    CharacterFieldCache& Touch(const void* address);
+
+    /**
+     * @brief Whether a tier must be read this extraction
+     * Both are due on first sight, which includes an entry reset by ResetForNewCharacter.
+     */
+    bool IsWarmDue(const CharacterFieldCache& entry) const;
+    bool IsColdDue(const CharacterFieldCache& entry) const { return !entry.coldValid; }
+
+    /**
+     * @brief Drop every cached field of an entry whose address now holds another character
+     * The entry is then treated as first sight: every tier is due on this extraction.
+     */
+    void ResetForNewCharacter(CharacterFieldCache& entry);
+
+    void MarkWarmRefreshed(CharacterFieldCache& entry);
+    void MarkColdRefreshed(CharacterFieldCache& entry);
+
+    void RecordWarmSkipped(uint32_t readsSaved);
+    void RecordColdSkipped(uint32_t readsSaved);
+    void RecordGearSkipped(uint32_t readsSaved);
+    void RecordChainsReused(uint32_t readsSaved);
+    void RecordChainsRewalked();
+
+    /**
+     * @brief Force a full re-read of every character on the next update (thread-safe)
+     */
+    void RequestInvalidateAll() { m_invalidateAllRequested.store(true, std::memory_order_release); }
+
+    FieldRefreshStats GetStats() const;
+
+private:
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        ankerl::unordered_dense::segmented_map<const void*, CharacterFieldCache> entries;
+    };
+
+    Shard& ShardFor(const void* address);
+
+    std::array<Shard, FieldRefresh::SCHEDULE_SHARD_COUNT> m_shards;
+    uint64_t m_updateIndex = 0;
+
+    // Per-update counters (extraction workers)
+    std::atomic<uint32_t> m_warmSkipped{ 0 };
+    std::atomic<uint32_t> m_coldSkipped{ 0 };
+    std::atomic<uint32_t> m_gearSkipped{ 0 };
+    std::atomic<uint32_t> m_chainsReused{ 0 };
+    std::atomic<uint32_t> m_chainsRewalked{ 0 };
+    std::atomic<uint64_t> m_readsSaved{ 0 };
+
+    // Published counters
+    std::atomic<bool> m_invalidateAllRequested{ false };
+    std::atomic<uint32_t> m_publishedTracked{ 0 };
+    std::atomic<uint32_t> m_publishedWarmSkipped{ 0 };
+    std::atomic<uint32_t> m_publishedColdSkipped{ 0 };
+    std::atomic<uint32_t> m_publishedGearSkipped{ 0 };
+    std::atomic<uint32_t> m_publishedChainsReused{ 0 };
+    std::atomic<uint32_t> m_publishedChainsRewalked{ 0 };
+    std::atomic<uint64_t> m_publishedReadsSaved{ 0 };
+    std::atomic<uint64_t> m_publishedReadsSavedTotal{ 0 };
+};
+
+} // namespace kx
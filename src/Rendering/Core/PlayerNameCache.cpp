@@ -0,0 +1,60 @@
+#include "PlayerNameCache.h"
+
+#include <cwchar>
+#include "../../Utils/MemorySafety.h"
+#include "../../Utils/SafeIterators.h"
+#include "../../Utils/StringHelpers.h"
+#include "../Data/RenderableData.h"
+
+namespace kx {
+
+namespace {
+    // Player names are at most a few dozen characters; anything longer is treated as garbage
+    constexpr size_t MAX_PLAYER_NAME_LENGTH = 256;
+}
+
+void PlayerNameCache::Update(ReClass::ChCliContext& charContext) {
+    ++m_updateIndex;
+    m_conversionsLastUpdate = 0;
+    StringArena& arena = GetEntityNameArena();
+
+    SafeAccess::PlayerList playerList(charContext);
+    for (auto playerIt = playerList.begin(); playerIt != playerList.end(); ++playerIt) {
+        if (!playerIt.IsValid()) {
+            continue;
+        }
+
+        const wchar_t* name = playerIt.GetName();
+        if (!SafeAccess::IsMemorySafe(const_cast<wchar_t*>(name))) {
+            continue;
+        }
+
+        auto [it, inserted] = m_entries.try_emplace(playerIt.GetCharacterDataPtr());
+        Entry& entry = it->second;
+        entry.lastSeenUpdate = m_updateIndex;
+
+        // Re-convert only if the name moved or was rewritten in place
+        const size_t length = wcsnlen(name, MAX_PLAYER_NAME_LENGTH);
+        if (!inserted && entry.sourceName == name && entry.wideName.compare(0, std::wstring::npos, name, length) == 0) {
+            arena.Touch(entry.name);
+            continue;
+        }
+
+        entry.sourceName = name;
+        entry.wideName.assign(name, length);
+        entry.name = arena.Intern(StringHelpers::WCharToUTF8String(entry.wideName.c_str()));
+        ++m_conversionsLastUpdate;
+    }
+
+    // Drop players that left the list
+    std::erase_if(m_entries, [this](const auto& entry) {
+        return entry.second.lastSeenUpdate != m_updateIndex;
+    });
+}
+
+void PlayerNameCache::Clear() {
+    m_entries.clear();
+    m_conversionsLastUpdate = 0;
+}
+
+} // namespace kx
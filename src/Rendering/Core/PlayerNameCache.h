@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <ankerl/unordered_dense.h>
+#include "../../Game/ReClassStructs.h"
+#include "../../Utils/StringArena.h"
+
+namespace kx {
+
+/**
+ * @brief Persistent map from player character pointer to its interned UTF-8 name
+ *
+ * Replaces the per-update characterToPlayerNameMap. Entries survive across updates and
+ * are only touched when the player list changes: a name is converted to UTF-8 and interned
+ * into the entity name arena when a player first appears, or when its wide-string pointer
+ * or contents change; players that leave the list are dropped at the end of Update(), and
+ * their names are reclaimed by the arena once nothing touches them. In steady state an
+ * update performs no allocations and no conversions.
+ *
+ * Update() runs on the pipeline thread; Find() is read-only and may be called from the
+ * extraction workers once Update() has returned.
+ */
+class PlayerNameCache {
+public:
+    /**
+     * @brief Sync the cache with the current player list
+     */
+    void Update(ReClass::ChCliContext& charContext);
+
+    /**
+     * @brief Drop every entry (e.g. when the context collection is unavailable)
+     */
+    void Clear();
+
+    /**
+     * @brief Interned name for a player character, or nullptr if the character is not a player
+     */
+    const StringHandle* Find(const void* character) const {
+        auto it = m_entries.find(character);
+        return it != m_entries.end() ? &it->second.name : nullptr;
+    }
+
+    size_t Size() const { return m_entries.size(); }
+
+    /**
+     * @brief Number of UTF-8 conversions performed by the last Update()
+     */
+    uint32_t GetConversionsLastUpdate() const { return m_conversionsLastUpdate; }
+
+private:
+    struct Entry {
+        const wchar_t* sourceName = nullptr;  // Game-owned pointer the name was converted from
+        std::wstring wideName;                // Copy of the source contents, to detect in-place edits
+        StringHandle name;                    // Interned in GetEntityNameArena()
+        uint64_t lastSeenUpdate = 0;
+    };
+
+    ankerl::unordered_dense::map<const void*, Entry> m_entries;
+    uint64_t m_updateIndex = 0;
+    uint32_t m_conversionsLastUpdate = 0;
+};
+
+} // namespace kx
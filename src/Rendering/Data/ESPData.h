@@ -5,6 +5,8 @@
 
 #include "../../libs/ImGui/imgui.h" // For ImU32, ImVec2
 #include "EntityRenderContext.h"
+#include "EntityTable.h"
+#include "../Combat/CombatState.h"
 
 // Forward declarations
 struct ImDrawList;
@@ -60,8 +62,9 @@ struct VisualProperties {
 struct FrameContext {
     const uint64_t now;
     Camera& camera;
-    CombatStateManager& stateManager;
-    const Settings& settings;
+    CombatStateManager& stateManager; // Owned by the pipeline worker - do not access from render-thread stages
+    const Settings& settings;         // Immutable snapshot for this update or frame; read this, not AppState's live settings
+    const uint64_t settingsVersion;   // Version of that snapshot, for caches derived from settings (see SettingsObserver)
     ImDrawList* drawList;
     const float screenWidth;
     const float screenHeight;
@@ -73,6 +76,10 @@ struct FinalizedRenderable {
     const RenderableEntity* entity;
     VisualProperties visuals;
     EntityRenderContext context;
+
+    // Range into PooledFrameRenderData::trailHistory (players with trails only)
+    uint32_t trailOffset = 0;
+    uint32_t trailCount = 0;
 };
 
 // MODIFIED: PooledFrameRenderData
@@ -84,15 +91,24 @@ struct PooledFrameRenderData {
     std::vector<RenderableGadget*> gadgets;
     std::vector<RenderableAttackTarget*> attackTargets;
 
+    // The same entities as rows of hot columns, in list order (see EntityTable)
+    EntityTable table;
+
     // NEW: A single vector to hold all entities after visuals have been calculated.
     std::vector<FinalizedRenderable> finalizedEntities;
 
+    // Position history copied out of the CombatStateManager for trail rendering,
+    // so the render thread never reads combat state owned by the pipeline worker.
+    std::vector<PositionHistoryPoint> trailHistory;
+
     void Reset() {
         players.clear();
         npcs.clear();
         gadgets.clear();
         attackTargets.clear();
+        table.Reset();
         finalizedEntities.clear();
+        trailHistory.clear();
     }
 };
 
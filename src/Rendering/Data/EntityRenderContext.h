@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "RenderableData.h"
 #include "ESPEntityTypes.h"
@@ -58,6 +60,11 @@ struct HealthBarAnimationState {
 };
 
 
+/**
+ * @brief Immutable, shareable detail lines of one entity (null when there are none)
+ */
+using DetailLines = std::shared_ptr<const std::vector<ColoredDetail>>;
+
 /**
  * @brief Unified context structure for entity rendering
  * 
@@ -87,8 +94,12 @@ struct EntityRenderContext {
     /** Primary color for rendering (box, dot, etc.) */
     unsigned int color;
     
-    /** Pre-built detail strings with colors (level, profession, etc.) */
-    std::vector<ColoredDetail> details;
+    /**
+     * Pre-built detail strings with colors (level, profession, etc.), or null if there are none.
+     * Shared with ESPContextFactory's detail cache and never modified once built, so a
+     * published snapshot keeps its lines alive while the cache moves on. Read via GetDetails().
+     */
+    DetailLines details;
     
     /** Calculated live burst DPS for the current damage window */
     float burstDPS;
@@ -128,8 +139,8 @@ struct EntityRenderContext {
     /** Pointer to the original entity for state lookup */
     const RenderableEntity* entity;
 
-    /** Player name (empty string for non-players) */
-    const std::string& playerName;
+    /** Player name resolved from the name arena (empty for non-players) */
+    std::string_view playerName;
 
     /** Transient animation state for the health bar */
     HealthBarAnimationState healthBarAnim;
@@ -150,6 +161,11 @@ struct EntityRenderContext {
     /** Damage/DPS feature flags (per-entity settings) */
     bool showDamageNumbers;
     bool showBurstDps;
+
+    const std::vector<ColoredDetail>& GetDetails() const {
+        static const std::vector<ColoredDetail> noDetails;
+        return details ? *details : noDetails;
+    }
 };
 
 } // namespace kx
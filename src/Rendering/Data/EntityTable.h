@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <vec3.hpp>
+#include "../../Game/GameEnums.h"
+#include "ESPEntityTypes.h"
+#include "RenderableData.h"
+#include "../Utils/LayoutConstants.h"
+
+namespace kx {
+
+/**
+ * @brief Per-row flags of an EntityTable
+ */
+namespace EntityRowFlags {
+    constexpr uint8_t VALID = 1 << 0;
+    constexpr uint8_t LOCAL_PLAYER = 1 << 1;
+    constexpr uint8_t GATHERABLE = 1 << 2;
+}
+
+/**
+ * @brief Struct-of-arrays view of the entities of one update
+ *
+ * The hot columns hold everything the filter and visuals stages decide on (position,
+ * distances, health, type, attitude and a type-specific subtype), packed contiguously so
+ * those stages stream through a few small arrays instead of pulling whole renderables
+ * into cache. The cold column points back at the pooled renderable, which keeps the
+ * names, gear and other detail data; it is only dereferenced for entities that survive.
+ *
+ * Rows are appended in pipeline order (players, NPCs, gadgets, attack targets), so
+ * iterating the table preserves the draw order of the pointer lists.
+ */
+struct EntityTable {
+    // --- Hot columns ---
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> boundsHalfExtents; // Half width, height and depth of the world box standing on the position
+    std::vector<float> visualDistances;      // Distance from camera, filled by the filter stage
+    std::vector<float> gameplayDistances;    // Distance from player, filled by the filter stage
+    std::vector<float> currentHealth;
+    std::vector<float> maxHealth;
+    std::vector<float> currentBarrier;
+    std::vector<ESPEntityType> entityTypes;
+    std::vector<Game::Attitude> attitudes;   // Neutral for gadgets and attack targets
+    std::vector<uint32_t> subtypes;          // NPC rank, gadget type or attack target combat state
+    std::vector<uint8_t> flags;              // EntityRowFlags
+
+    // --- Cold column ---
+    std::vector<RenderableEntity*> entities; // Pooled renderable with names, gear and details
+
+    size_t Size() const { return entities.size(); }
+
+    void Reset() {
+        positions.clear();
+        boundsHalfExtents.clear();
+        visualDistances.clear();
+        gameplayDistances.clear();
+        currentHealth.clear();
+        maxHealth.clear();
+        currentBarrier.clear();
+        entityTypes.clear();
+        attitudes.clear();
+        subtypes.clear();
+        flags.clear();
+        entities.clear();
+    }
+
+    void Reserve(size_t count) {
+        positions.reserve(count);
+        boundsHalfExtents.reserve(count);
+        visualDistances.reserve(count);
+        gameplayDistances.reserve(count);
+        currentHealth.reserve(count);
+        maxHealth.reserve(count);
+        currentBarrier.reserve(count);
+        entityTypes.reserve(count);
+        attitudes.reserve(count);
+        subtypes.reserve(count);
+        flags.reserve(count);
+        entities.reserve(count);
+    }
+
+    /**
+     * @brief Append a row for a pooled renderable (distances start at zero)
+     */
+    void Append(RenderableEntity* entity) {
+        Game::Attitude attitude = Game::Attitude::Neutral;
+        uint32_t subtype = 0;
+        uint8_t rowFlags = entity->isValid ? EntityRowFlags::VALID : 0;
+
+        switch (entity->entityType) {
+            case ESPEntityType::Player: {
+                const auto* player = static_cast<const RenderablePlayer*>(entity);
+                attitude = player->attitude;
+                if (player->isLocalPlayer) rowFlags |= EntityRowFlags::LOCAL_PLAYER;
+                break;
+            }
+            case ESPEntityType::NPC: {
+                const auto* npc = static_cast<const RenderableNpc*>(entity);
+                attitude = npc->attitude;
+                subtype = static_cast<uint32_t>(npc->rank);
+                break;
+            }
+            case ESPEntityType::Gadget: {
+                const auto* gadget = static_cast<const RenderableGadget*>(entity);
+                subtype = static_cast<uint32_t>(gadget->type);
+                if (gadget->isGatherable) rowFlags |= EntityRowFlags::GATHERABLE;
+                break;
+            }
+            case ESPEntityType::AttackTarget:
+                subtype = static_cast<uint32_t>(static_cast<const RenderableAttackTarget*>(entity)->combatState);
+                break;
+        }
+
+        positions.push_back(entity->position);
+        boundsHalfExtents.push_back(BoundsHalfExtentsOf(*entity));
+        visualDistances.push_back(0.0f);
+        gameplayDistances.push_back(0.0f);
+        currentHealth.push_back(entity->currentHealth);
+        maxHealth.push_back(entity->maxHealth);
+        currentBarrier.push_back(entity->currentBarrier);
+        entityTypes.push_back(entity->entityType);
+        attitudes.push_back(attitude);
+        subtypes.push_back(subtype);
+        flags.push_back(rowFlags);
+        entities.push_back(entity);
+    }
+
+    /**
+     * @brief Copy row `index` of another table onto the end of this one
+     */
+    void AppendRow(const EntityTable& source, size_t index) {
+        positions.push_back(source.positions[index]);
+        boundsHalfExtents.push_back(source.boundsHalfExtents[index]);
+        visualDistances.push_back(source.visualDistances[index]);
+        gameplayDistances.push_back(source.gameplayDistances[index]);
+        currentHealth.push_back(source.currentHealth[index]);
+        maxHealth.push_back(source.maxHealth[index]);
+        currentBarrier.push_back(source.currentBarrier[index]);
+        entityTypes.push_back(source.entityTypes[index]);
+        attitudes.push_back(source.attitudes[index]);
+        subtypes.push_back(source.subtypes[index]);
+        flags.push_back(source.flags[index]);
+        entities.push_back(source.entities[index]);
+    }
+
+    /**
+     * @brief The world box EntityVisualsCalculator projects: physics dimensions, else the per-type defaults
+     */
+    static glm::vec3 BoundsHalfExtentsOf(const RenderableEntity& entity) {
+        float width, depth, height;
+        if (entity.hasPhysicsDimensions) {
+            width = entity.physicsWidth;
+            depth = entity.physicsDepth;
+            height = entity.physicsHeight;
+        } else {
+            switch (entity.entityType) {
+                case ESPEntityType::Player:
+                    width = EntityWorldBounds::PLAYER_WORLD_WIDTH;
+                    depth = EntityWorldBounds::PLAYER_WORLD_DEPTH;
+                    height = EntityWorldBounds::PLAYER_WORLD_HEIGHT;
+                    break;
+                case ESPEntityType::Gadget:
+                case ESPEntityType::AttackTarget:
+                    width = EntityWorldBounds::GADGET_WORLD_WIDTH;
+                    depth = EntityWorldBounds::GADGET_WORLD_DEPTH;
+                    height = EntityWorldBounds::GADGET_WORLD_HEIGHT;
+                    break;
+                case ESPEntityType::NPC:
+                default:
+                    width = EntityWorldBounds::NPC_WORLD_WIDTH;
+                    depth = EntityWorldBounds::NPC_WORLD_DEPTH;
+                    height = EntityWorldBounds::NPC_WORLD_HEIGHT;
+                    break;
+            }
+        }
+
+        // Attack targets are drawn as cubes of their height
+        if (entity.entityType == ESPEntityType::AttackTarget) {
+            width = height;
+            depth = height;
+        }
+
+        // Negative garbage would shrink the box below its position; NaN stays NaN and is never culled
+        return glm::vec3(std::max(width, 0.0f), std::max(height, 0.0f), std::max(depth, 0.0f)) * 0.5f;
+    }
+};
+
+} // namespace kx
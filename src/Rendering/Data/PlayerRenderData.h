@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <string>
 #include "../../Game/GameEnums.h"
 #include "../../../libs/ImGui/imgui.h"
@@ -14,8 +15,53 @@ struct GearSlotInfo {
     uint32_t statId = 0;
     Game::ItemRarity rarity = Game::ItemRarity::None;
     // We can add fields for upgrades, rarity, etc. here later.
+
+    bool IsEquipped() const { return itemId != 0; }
 };
 
+/**
+ * @brief The equipment slots we inspect and where each lives in a GearArray
+ */
+namespace GearLayout {
+    constexpr size_t SLOT_COUNT = 16;
+
+    // GearArray index i holds the item equipped in SLOTS[i]
+    constexpr std::array<Game::EquipmentSlot, SLOT_COUNT> SLOTS = {
+        Game::EquipmentSlot::Helm, Game::EquipmentSlot::Shoulders, Game::EquipmentSlot::Chest,
+        Game::EquipmentSlot::Gloves, Game::EquipmentSlot::Pants, Game::EquipmentSlot::Boots,
+        Game::EquipmentSlot::Back, Game::EquipmentSlot::Amulet, Game::EquipmentSlot::Accessory1,
+        Game::EquipmentSlot::Accessory2, Game::EquipmentSlot::Ring1, Game::EquipmentSlot::Ring2,
+        Game::EquipmentSlot::MainhandWeapon1, Game::EquipmentSlot::OffhandWeapon1,
+        Game::EquipmentSlot::MainhandWeapon2, Game::EquipmentSlot::OffhandWeapon2
+    };
+
+    /**
+     * @brief GearArray index of a slot, or -1 if the slot isn't inspected
+     */
+    constexpr int IndexOf(Game::EquipmentSlot slot) {
+        for (size_t i = 0; i < SLOT_COUNT; ++i) {
+            if (SLOTS[i] == slot) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+}
+
+/**
+ * @brief Equipped gear, one entry per GearLayout slot (unequipped slots have itemId 0)
+ */
+using GearArray = std::array<GearSlotInfo, GearLayout::SLOT_COUNT>;
+
+inline bool HasAnyGear(const GearArray& gear) {
+    for (const auto& info : gear) {
+        if (info.IsEquipped()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 struct CompactStatInfo {
     std::string statName;
     int count = 0;
@@ -1,16 +1,57 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
 #include <vec3.hpp>
 #include <vec2.hpp>
 #include "../../Game/GameEnums.h"
 #include "../../../libs/ImGui/imgui.h"
+#include "../../Utils/StringArena.h"
 #include "PlayerRenderData.h"
 #include "ESPEntityTypes.h"
 
 namespace kx {
 
+namespace EntityNameArenaDetail {
+    // Replaces the shared arena on threads inside a ScopedEntityNameArena
+    inline StringArena*& ThreadOverride() {
+        static thread_local StringArena* arena = nullptr;
+        return arena;
+    }
+}
+
+/**
+ * @brief Arena every renderable name is interned into
+ *
+ * Written by the ESP pipeline thread during extraction; handles stored in renderables
+ * can be resolved from the render thread for as long as their snapshot is held.
+ */
+inline StringArena& GetEntityNameArena() {
+    static StringArena arena;
+    StringArena* override = EntityNameArenaDetail::ThreadOverride();
+    return override ? *override : arena;
+}
+
+/**
+ * @brief Makes GetEntityNameArena() return another arena on the calling thread while in scope
+ *
+ * Test seam: tests intern into an arena of their own, because the shared one may only be
+ * written by the pipeline thread, whose EndUpdate() would also reclaim the test's handles.
+ */
+class ScopedEntityNameArena {
+public:
+    explicit ScopedEntityNameArena(StringArena& arena)
+        : m_previous(EntityNameArenaDetail::ThreadOverride()) {
+        EntityNameArenaDetail::ThreadOverride() = &arena;
+    }
+    ~ScopedEntityNameArena() { EntityNameArenaDetail::ThreadOverride() = m_previous; }
+
+    ScopedEntityNameArena(const ScopedEntityNameArena&) = delete;
+    ScopedEntityNameArena& operator=(const ScopedEntityNameArena&) = delete;
+
+private:
+    StringArena* m_previous;
+};
+
 // Safe data structures for the two-stage rendering pipeline
 // These contain only plain data types, no pointers to game memory
 // Now using proper enum types for better type safety
@@ -53,8 +94,8 @@ struct RenderableEntity {
 };
 
 struct RenderablePlayer : public RenderableEntity {
-    std::string characterName;
-    std::string playerName;
+    StringHandle characterName;      // Interned in GetEntityNameArena()
+    StringHandle playerName;
     float currentEnergy;
     float maxEnergy;
     float currentSpecialEnergy;
@@ -66,7 +107,7 @@ struct RenderablePlayer : public RenderableEntity {
     Game::Race race;                 // Type-safe enum for character race
     bool isLocalPlayer; // Flag to identify if this is the local player
 
-    std::unordered_map<Game::EquipmentSlot, GearSlotInfo> gear;
+    GearArray gear{};
     
     RenderablePlayer() : RenderableEntity(),
                          currentEnergy(0.0f), maxEnergy(0.0f),
@@ -79,7 +120,7 @@ struct RenderablePlayer : public RenderableEntity {
 };
 
 struct RenderableNpc : public RenderableEntity {
-    std::string name;
+    StringHandle name;
     uint32_t level;
     Game::Attitude attitude;         // Type-safe enum instead of uint32_t
     Game::CharacterRank rank;
@@ -91,7 +132,7 @@ struct RenderableNpc : public RenderableEntity {
 };
 
 struct RenderableGadget : public RenderableEntity {
-    std::string name;
+    StringHandle name;
     Game::GadgetType type;           // Type-safe enum instead of uint32_t
     Game::ResourceNodeType resourceType;
     bool isGatherable;               // Additional flag for resource nodes
@@ -10,6 +10,8 @@
 #include "../Utils/ESPPlayerDetailsBuilder.h"
 #include "../Utils/ESPEntityDetailsBuilder.h"
 #include "../Data/ESPEntityTypes.h"
+#include "../Utils/DetailInputHash.h"
+#include <ankerl/unordered_dense.h>
 
 namespace kx {
 
@@ -55,23 +57,124 @@ static bool DetermineGadgetHealthBarVisibility(const RenderableGadget* gadget, c
     return true;
 }
 
-float CalculateBurstDps(const EntityCombatState* state, uint64_t now, bool showBurstDpsSetting) {
-    float burstDpsValue = 0.0f;
-    if (showBurstDpsSetting) {
-        if (state && state->burstStartTime > 0 && state->accumulatedDamage > 0.0f) {
-            uint64_t durationMs = now - state->burstStartTime;
-            if (durationMs > 100) {
-                float durationSeconds = static_cast<float>(durationMs) / 1000.0f;
-                burstDpsValue = state->accumulatedDamage / durationSeconds;
+float CalculateBurstDps(const CombatStateManager& stateManager, const void* entityId, uint64_t now, bool showBurstDpsSetting) {
+    if (!showBurstDpsSetting) {
+        return 0.0f;
+    }
+    // Rate over the current burst, from the burst's accumulated damage
+    return stateManager.GetBurstDps(entityId, now);
+}
+
+// Detail lines per entity address, reused across updates until the hash of the values they
+// were formatted from changes (pipeline thread only). Lines are immutable once built; a
+// rebuild replaces the pointer, so snapshots still holding the old lines are unaffected.
+struct DetailCacheEntry {
+    uint64_t inputHash = 0;
+    uint64_t lastUsedTime = 0;
+    bool built = false;
+    DetailLines lines;
+};
+
+constexpr uint64_t DETAIL_CACHE_EXPIRY_MS = 5000;         // Forget entities not seen for this long
+constexpr uint64_t DETAIL_CACHE_PRUNE_INTERVAL_MS = 1000;
+
+ankerl::unordered_dense::map<const void*, DetailCacheEntry> s_detailCache;
+uint64_t s_lastDetailCachePruneTime = 0;
+
+uint64_t HashDetailInputs(const RenderableEntity* entity, const Settings& settings) {
+    switch (entity->entityType) {
+        case ESPEntityType::Player:
+        {
+            const auto* player = static_cast<const RenderablePlayer*>(entity);
+            DetailInputHash hash;
+            hash.Add(ESPPlayerDetailsBuilder::HashPlayerDetailInputs(player, settings.playerESP, settings.showDebugAddresses));
+            hash.Add(settings.playerESP.gearDisplayMode);
+            if (settings.playerESP.gearDisplayMode == GearDisplayMode::Detailed) {
+                hash.Add(ESPPlayerDetailsBuilder::HashGearDetailInputs(player));
+            }
+            return hash.Get();
+        }
+        case ESPEntityType::NPC:
+            return ESPEntityDetailsBuilder::HashNpcDetailInputs(static_cast<const RenderableNpc*>(entity), settings.npcESP, settings.showDebugAddresses);
+        case ESPEntityType::Gadget:
+            return ESPEntityDetailsBuilder::HashGadgetDetailInputs(static_cast<const RenderableGadget*>(entity), settings.objectESP, settings.showDebugAddresses);
+        case ESPEntityType::AttackTarget:
+            return ESPEntityDetailsBuilder::HashAttackTargetDetailInputs(static_cast<const RenderableAttackTarget*>(entity), settings.objectESP, settings.showDebugAddresses);
+    }
+    return DetailInputHash().Add(entity->entityType).Get();
+}
+
+std::vector<ColoredDetail> BuildDetails(const RenderableEntity* entity, const Settings& settings) {
+    std::vector<ColoredDetail> details;
+    // Use a switch on entity->entityType to call the correct details builder
+    switch(entity->entityType) {
+        case ESPEntityType::Player:
+        {
+            const auto* player = static_cast<const RenderablePlayer*>(entity);
+            details = ESPPlayerDetailsBuilder::BuildPlayerDetails(player, settings.playerESP, settings.showDebugAddresses);
+            if (settings.playerESP.gearDisplayMode == GearDisplayMode::Detailed) {
+                auto gearDetails = ESPPlayerDetailsBuilder::BuildGearDetails(player);
+                if (!gearDetails.empty()) {
+                    if (!details.empty()) {
+                        details.push_back({ "--- Gear Stats ---", ESPColors::DEFAULT_TEXT });
+                    }
+                    details.insert(details.end(), gearDetails.begin(), gearDetails.end());
+                }
             }
+            break;
+        }
+        case ESPEntityType::NPC:
+        {
+            const auto* npc = static_cast<const RenderableNpc*>(entity);
+            details = ESPEntityDetailsBuilder::BuildNpcDetails(npc, settings.npcESP, settings.showDebugAddresses);
+            break;
+        }
+        case ESPEntityType::Gadget:
+        {
+            const auto* gadget = static_cast<const RenderableGadget*>(entity);
+            details = ESPEntityDetailsBuilder::BuildGadgetDetails(gadget, settings.objectESP, settings.showDebugAddresses);
+            break;
+        }
+        case ESPEntityType::AttackTarget:
+        {
+            const auto* attackTarget = static_cast<const RenderableAttackTarget*>(entity);
+            details = ESPEntityDetailsBuilder::BuildAttackTargetDetails(attackTarget, settings.objectESP, settings.showDebugAddresses);
+            break;
         }
     }
-    return burstDpsValue;
+    return details;
+}
+
+void PruneDetailCache(uint64_t now) {
+    if (now - s_lastDetailCachePruneTime < DETAIL_CACHE_PRUNE_INTERVAL_MS) {
+        return;
+    }
+    s_lastDetailCachePruneTime = now;
+    std::erase_if(s_detailCache, [now](const auto& item) {
+        return now - item.second.lastUsedTime > DETAIL_CACHE_EXPIRY_MS;
+    });
+}
+
+DetailLines AcquireDetails(const RenderableEntity* entity, const FrameContext& context) {
+    PruneDetailCache(context.now);
+
+    const uint64_t inputHash = HashDetailInputs(entity, context.settings);
+    DetailCacheEntry& entry = s_detailCache[entity->address]; // Allocates only for entities not seen before
+    entry.lastUsedTime = context.now;
+    if (entry.built && entry.inputHash == inputHash) {
+        return entry.lines;
+    }
+
+    std::vector<ColoredDetail> details = BuildDetails(entity, context.settings);
+    entry.lines = details.empty() ? nullptr : std::make_shared<const std::vector<ColoredDetail>>(std::move(details));
+    entry.inputHash = inputHash;
+    entry.built = true;
+    return entry.lines;
 }
 
 } // anonymous namespace
 
-EntityRenderContext ESPContextFactory::CreateContextForPlayer(const RenderablePlayer* player, const std::vector<ColoredDetail>& details, const FrameContext& context) {
+EntityRenderContext ESPContextFactory::CreateContextForPlayer(const RenderablePlayer* player, DetailLines details, const FrameContext& context) {
     // Use attitude-based coloring for players (same as NPCs for semantic consistency)
     unsigned int color = ESPStyling::GetEntityColor(*player);
 
@@ -84,7 +187,8 @@ EntityRenderContext ESPContextFactory::CreateContextForPlayer(const RenderablePl
         PopulateHealthBarAnimations(player, state, animState, context.now); // Pass 'now' to the animation logic
     }
     
-    float burstDpsValue = CalculateBurstDps(state, context.now, context.settings.playerESP.showBurstDps);
+    float burstDpsValue = CalculateBurstDps(context.stateManager, player->address, context.now, context.settings.playerESP.showBurstDps);
+    const bool hasDetails = details != nullptr; // Read before details is moved into the context
     
     return EntityRenderContext{
         .position = player->position,
@@ -95,7 +199,7 @@ EntityRenderContext ESPContextFactory::CreateContextForPlayer(const RenderablePl
         .renderBox = context.settings.playerESP.renderBox,
         .renderDistance = context.settings.playerESP.renderDistance,
         .renderDot = context.settings.playerESP.renderDot,
-        .renderDetails = !details.empty(),
+        .renderDetails = hasDetails,
         .renderHealthBar = renderHealthBar,
         .renderHealthPercentage = context.settings.playerESP.showHealthPercentage,
         .renderEnergyBar = context.settings.playerESP.renderEnergyBar,
@@ -103,7 +207,7 @@ EntityRenderContext ESPContextFactory::CreateContextForPlayer(const RenderablePl
         .entityType = ESPEntityType::Player,
         .attitude = player->attitude,
         .entity = player,
-        .playerName = player->playerName,
+        .playerName = GetEntityNameArena().Resolve(player->playerName),
         .healthBarAnim = animState,
         .renderGadgetSphere = false,
         .renderGadgetCircle = false,
@@ -115,7 +219,7 @@ EntityRenderContext ESPContextFactory::CreateContextForPlayer(const RenderablePl
     };
 }
 
-EntityRenderContext ESPContextFactory::CreateContextForNpc(const RenderableNpc* npc, const std::vector<ColoredDetail>& details, const FrameContext& context) {
+EntityRenderContext ESPContextFactory::CreateContextForNpc(const RenderableNpc* npc, DetailLines details, const FrameContext& context) {
     // Use attitude-based coloring for NPCs
     unsigned int color = ESPStyling::GetEntityColor(*npc);
 
@@ -128,9 +232,8 @@ EntityRenderContext ESPContextFactory::CreateContextForNpc(const RenderableNpc*
         PopulateHealthBarAnimations(npc, state, animState, context.now); // Pass 'now' to the animation logic
     }
     
-    float burstDpsValue = CalculateBurstDps(state, context.now, context.settings.npcESP.showBurstDps);
+    float burstDpsValue = CalculateBurstDps(context.stateManager, npc->address, context.now, context.settings.npcESP.showBurstDps);
     
-    static const std::string emptyPlayerName = "";
     return EntityRenderContext{
         .position = npc->position,
         .gameplayDistance = npc->gameplayDistance,
@@ -148,7 +251,7 @@ EntityRenderContext ESPContextFactory::CreateContextForNpc(const RenderableNpc*
         .entityType = ESPEntityType::NPC,
         .attitude = npc->attitude,
         .entity = npc,
-        .playerName = emptyPlayerName,
+        .playerName = {},
         .healthBarAnim = animState,
         .renderGadgetSphere = false,
         .renderGadgetCircle = false,
@@ -160,9 +263,7 @@ EntityRenderContext ESPContextFactory::CreateContextForNpc(const RenderableNpc*
     };
 }
 
-EntityRenderContext ESPContextFactory::CreateContextForGadget(const RenderableGadget* gadget, const std::vector<ColoredDetail>& details, const FrameContext& context) {
-    static const std::string emptyPlayerName = "";
-
+EntityRenderContext ESPContextFactory::CreateContextForGadget(const RenderableGadget* gadget, DetailLines details, const FrameContext& context) {
     const EntityCombatState* state = context.stateManager.GetState(gadget->address);
     bool renderHealthBar = DetermineGadgetHealthBarVisibility(gadget, context.settings.objectESP, state, context.now);
 
@@ -174,7 +275,7 @@ EntityRenderContext ESPContextFactory::CreateContextForGadget(const RenderableGa
         }
     }
 
-    float burstDpsValue = CalculateBurstDps(state, context.now, context.settings.objectESP.showBurstDps);
+    float burstDpsValue = CalculateBurstDps(context.stateManager, gadget->address, context.now, context.settings.objectESP.showBurstDps);
 
     // Check if combat UI should be hidden for this gadget type
     bool hideCombatUI = ESPStyling::ShouldHideCombatUIForGadget(gadget->type);
@@ -204,7 +305,7 @@ EntityRenderContext ESPContextFactory::CreateContextForGadget(const RenderableGa
         .entityType = ESPEntityType::Gadget,
         .attitude = Game::Attitude::Neutral,
         .entity = gadget,
-        .playerName = emptyPlayerName,
+        .playerName = {},
         .healthBarAnim = animState,
         .renderGadgetSphere = context.settings.objectESP.renderSphere,
         .renderGadgetCircle = context.settings.objectESP.renderCircle,
@@ -216,9 +317,7 @@ EntityRenderContext ESPContextFactory::CreateContextForGadget(const RenderableGa
     };
 }
 
-EntityRenderContext ESPContextFactory::CreateContextForAttackTarget(const RenderableAttackTarget* attackTarget, const std::vector<ColoredDetail>& details, const FrameContext& context) {
-    static const std::string emptyPlayerName = "";
-
+EntityRenderContext ESPContextFactory::CreateContextForAttackTarget(const RenderableAttackTarget* attackTarget, DetailLines details, const FrameContext& context) {
     const EntityCombatState* state = context.stateManager.GetState(attackTarget->address);
     bool renderHealthBar = false; // Attack targets typically don't have health data
 
@@ -226,7 +325,7 @@ EntityRenderContext ESPContextFactory::CreateContextForAttackTarget(const Render
     HealthBarAnimationState animState;
     // Attack targets don't typically have health, so no animation state needed
 
-    float burstDpsValue = CalculateBurstDps(state, context.now, context.settings.objectESP.showBurstDps);
+    float burstDpsValue = CalculateBurstDps(context.stateManager, attackTarget->address, context.now, context.settings.objectESP.showBurstDps);
 
     bool hideCombatUI = false; // Can be customized if needed
 
@@ -257,7 +356,7 @@ EntityRenderContext ESPContextFactory::CreateContextForAttackTarget(const Render
         .entityType = ESPEntityType::AttackTarget,
         .attitude = Game::Attitude::Neutral,
         .entity = attackTarget,
-        .playerName = emptyPlayerName,
+        .playerName = {},
         .healthBarAnim = animState,
         .renderGadgetSphere = context.settings.objectESP.renderSphere,
         .renderGadgetCircle = context.settings.objectESP.renderCircle,
@@ -270,59 +369,23 @@ EntityRenderContext ESPContextFactory::CreateContextForAttackTarget(const Render
 }
 
 EntityRenderContext ESPContextFactory::CreateEntityRenderContextForRendering(const RenderableEntity* entity, const FrameContext& context) {
-    std::vector<ColoredDetail> details;
-    // Use a switch on entity->entityType to call the correct details builder
-    switch(entity->entityType) {
-        case ESPEntityType::Player:
-        {
-            const auto* player = static_cast<const RenderablePlayer*>(entity);
-            details = ESPPlayerDetailsBuilder::BuildPlayerDetails(player, context.settings.playerESP, context.settings.showDebugAddresses);
-            if (context.settings.playerESP.gearDisplayMode == GearDisplayMode::Detailed) {
-                auto gearDetails = ESPPlayerDetailsBuilder::BuildGearDetails(player);
-                if (!gearDetails.empty()) {
-                    if (!details.empty()) {
-                        details.push_back({ "--- Gear Stats ---", ESPColors::DEFAULT_TEXT });
-                    }
-                    details.insert(details.end(), gearDetails.begin(), gearDetails.end());
-                }
-            }
-            break;
-        }
-        case ESPEntityType::NPC:
-        {
-            const auto* npc = static_cast<const RenderableNpc*>(entity);
-            details = ESPEntityDetailsBuilder::BuildNpcDetails(npc, context.settings.npcESP, context.settings.showDebugAddresses);
-            break;
-        }
-        case ESPEntityType::Gadget:
-        {
-            const auto* gadget = static_cast<const RenderableGadget*>(entity);
-            details = ESPEntityDetailsBuilder::BuildGadgetDetails(gadget, context.settings.objectESP, context.settings.showDebugAddresses);
-            break;
-        }
-        case ESPEntityType::AttackTarget:
-        {
-            const auto* attackTarget = static_cast<const RenderableAttackTarget*>(entity);
-            details = ESPEntityDetailsBuilder::BuildAttackTargetDetails(attackTarget, context.settings.objectESP, context.settings.showDebugAddresses);
-            break;
-        }
-    }
+    DetailLines details = AcquireDetails(entity, context);
 
     // Now, create the context using the ESPContextFactory, just like before.
     // We pass the main 'context' directly.
     switch(entity->entityType) {
         case ESPEntityType::Player:
-            return CreateContextForPlayer(static_cast<const RenderablePlayer*>(entity), details, context);
+            return CreateContextForPlayer(static_cast<const RenderablePlayer*>(entity), std::move(details), context);
         case ESPEntityType::NPC:
-            return CreateContextForNpc(static_cast<const RenderableNpc*>(entity), details, context);
+            return CreateContextForNpc(static_cast<const RenderableNpc*>(entity), std::move(details), context);
         case ESPEntityType::Gadget:
-            return CreateContextForGadget(static_cast<const RenderableGadget*>(entity), details, context);
+            return CreateContextForGadget(static_cast<const RenderableGadget*>(entity), std::move(details), context);
         case ESPEntityType::AttackTarget:
-            return CreateContextForAttackTarget(static_cast<const RenderableAttackTarget*>(entity), details, context);
+            return CreateContextForAttackTarget(static_cast<const RenderableAttackTarget*>(entity), std::move(details), context);
     }
     // This should not be reached, but we need to return something.
     // Returning a gadget context as a fallback.
-    return CreateContextForGadget(static_cast<const RenderableGadget*>(entity), details, context);
+    return CreateContextForGadget(static_cast<const RenderableGadget*>(entity), std::move(details), context);
 }
 
 } // namespace kx
\ No newline at end of file
@@ -11,12 +11,14 @@ class CombatStateManager; // Forward declaration
 
 class ESPContextFactory {
 public:
-    static EntityRenderContext CreateContextForPlayer(const RenderablePlayer* player, const std::vector<ColoredDetail>& details, const FrameContext& context);
-    static EntityRenderContext CreateContextForNpc(const RenderableNpc* npc, const std::vector<ColoredDetail>& details, const FrameContext& context);
-    static EntityRenderContext CreateContextForGadget(const RenderableGadget* gadget, const std::vector<ColoredDetail>& details, const FrameContext& context);
-    static EntityRenderContext CreateContextForAttackTarget(const RenderableAttackTarget* attackTarget, const std::vector<ColoredDetail>& details, const FrameContext& context);
+    static EntityRenderContext CreateContextForPlayer(const RenderablePlayer* player, DetailLines details, const FrameContext& context);
+    static EntityRenderContext CreateContextForNpc(const RenderableNpc* npc, DetailLines details, const FrameContext& context);
+    static EntityRenderContext CreateContextForGadget(const RenderableGadget* gadget, DetailLines details, const FrameContext& context);
+    static EntityRenderContext CreateContextForAttackTarget(const RenderableAttackTarget* attackTarget, DetailLines details, const FrameContext& context);
     
-    // Helper function to build the render context with details
+    // Helper function to build the render context with details.
+    // Detail lines are cached per entity and only rebuilt when the values they show change
+    // (pipeline thread only).
     static EntityRenderContext CreateEntityRenderContextForRendering(const RenderableEntity* entity, const FrameContext& context);
 };
 
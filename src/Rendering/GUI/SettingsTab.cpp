@@ -6,9 +6,15 @@
 #include "../../Core/AppState.h"
 #include "../../Core/SettingsManager.h"
 #include "../../Utils/DebugLogger.h"
+#include "../../Utils/MemorySafety.h"
 #include "../../Game/AddressManager.h"
 #include "../../Game/ReClassStructs.h"
 #include "../../Core/Config.h"
+#include "../Core/EntityExtractor.h"
+#include "../Core/EntityRefreshSchedule.h"
+#include "../Core/ESPPipelineWorker.h"
+#include "../Core/ESPRenderer.h"
+#include "../Data/RenderableData.h"
 
 namespace kx {
     namespace GUI {
@@ -86,7 +92,7 @@ namespace kx {
                     }
                     ImGui::SameLine();
                     if (ImGui::Button("Reload Settings")) {
-                        SettingsManager::Load(settings);
+                        AppState::Get().ReloadSettings();
                         Debug::Logger::SetMinLogLevel(static_cast<Debug::Logger::Level>(settings.logLevel));
                     }
                     ImGui::SameLine();
@@ -130,6 +136,57 @@ namespace kx {
                     if (ImGui::IsItemHovered()) {
                         ImGui::SetTooltip("Lower values improve performance but make ESP less responsive.\nRecommended: 60-120 FPS for good balance, up to 360 FPS for high refresh displays.");
                     }
+
+                    if (ImGui::TreeNode("Diagnostics")) {
+                        const FieldRefreshStats refreshStats = EntityExtractor::GetFieldRefreshStats();
+                        ImGui::Text("Tracked characters: %u", refreshStats.trackedEntities);
+                        ImGui::Text("Cached warm/cold tiers: %u / %u", refreshStats.warmSkipped, refreshStats.coldSkipped);
+                        ImGui::Text("Unchanged gear fingerprints: %u", refreshStats.gearSkipped);
+                        ImGui::Text("Cached pointer chains: %u reused / %u re-walked", refreshStats.chainsReused, refreshStats.chainsRewalked);
+                        ImGui::Text("Field reads saved: %llu per update (%llu total)",
+                                    static_cast<unsigned long long>(refreshStats.readsSavedLastUpdate),
+                                    static_cast<unsigned long long>(refreshStats.readsSavedTotal));
+                        if (ImGui::Button("Refresh Cached Entity Data")) {
+                            EntityExtractor::InvalidateCachedFields();
+                        }
+                        if (ImGui::IsItemHovered()) {
+                            ImGui::SetTooltip("Re-read gear, profession, level and other rarely changing fields for every character.");
+                        }
+
+                        const StringArenaStats nameStats = GetEntityNameArena().GetStats();
+                        ImGui::Text("Interned names: %u (%u reclaimed last update, %zu KB reserved)",
+                                    nameStats.liveStrings, nameStats.reclaimedLastUpdate, nameStats.reservedBytes / 1024);
+
+                        // Entity pools: in use / allocated per snapshot, and the peak ever needed
+                        const PipelinePoolStats poolStats = ESPRenderer::GetPoolStats();
+                        auto poolLine = [](const char* label, const ObjectPoolStats& stats) {
+                            ImGui::Text("%s pool: %zu / %zu (peak %zu)", label, stats.used, stats.capacity, stats.highWater);
+                            if (stats.exhaustedRequests > 0) {
+                                ImGui::SameLine();
+                                ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%zu dropped", stats.exhaustedRequests);
+                            }
+                        };
+                        poolLine("Player", poolStats.players);
+                        poolLine("NPC", poolStats.npcs);
+                        poolLine("Gadget", poolStats.gadgets);
+                        poolLine("Attack target", poolStats.attackTargets);
+
+                        const FrustumCullStats cullStats = ESPRenderer::GetCullStats();
+                        ImGui::Text("Frustum cull: %.1f%% culled (%zu of %zu filtered entities)",
+                                    cullStats.GetCullRatio() * 100.0f, cullStats.culled, cullStats.tested);
+
+                        const PointerValidationStats validationStats = SafeAccess::GetValidationTelemetry().GetLastUpdate();
+                        ImGui::Text("Pointer validation: %.1f%% cached (%llu checks per update)",
+                                    validationStats.GetHitRate() * 100.0f,
+                                    static_cast<unsigned long long>(validationStats.lookups));
+                        ImGui::Text("VirtualQuery: %llu calls, %llu us per update",
+                                    static_cast<unsigned long long>(validationStats.queries),
+                                    static_cast<unsigned long long>(validationStats.queryMicroseconds));
+                        ImGui::Text("VTable verdicts: %.1f%% cached, %llu wrong-kind entries rejected",
+                                    validationStats.GetVTableHitRate() * 100.0f,
+                                    static_cast<unsigned long long>(validationStats.vtableMistyped));
+                        ImGui::TreePop();
+                    }
                 }
                 
                 // Debug Settings
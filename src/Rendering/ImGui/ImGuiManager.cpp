@@ -193,6 +193,9 @@ void ImGuiManager::RenderUI(kx::Camera& camera,
     if (kx::AppState::Get().IsVisionWindowOpen()) {
         RenderESPWindow(mumbleLinkManager, mumbleLinkData);
     }
+
+    // Tabs edit the live settings in place; turn this frame's edits into a new settings version
+    kx::AppState::Get().PublishSettings();
 }
 
 void ImGuiManager::RenderHints() {
@@ -115,7 +115,7 @@ void LayoutCalculator::GatherPlayerIdentityElements(
 
     // Player Name (fallback to profession if name is empty)
     if (entityContext.renderPlayerName) {
-        std::string displayName = entityContext.playerName;
+        std::string displayName(entityContext.playerName);
         
         // Fallback to profession for hostile players without names (WvW)
         if (displayName.empty() && entityContext.entityType == ESPEntityType::Player) {
@@ -167,8 +167,8 @@ void LayoutCalculator::GatherDetailElements(
     const auto& props = request.visualProps;
 
     // Entity Details
-    if (entityContext.renderDetails && !entityContext.details.empty()) {
-        TextElement element = TextElementFactory::CreateDetailsText(entityContext.details, {0,0}, 0, props.finalFontSize);
+    if (entityContext.renderDetails && !entityContext.GetDetails().empty()) {
+        TextElement element = TextElementFactory::CreateDetailsText(entityContext.GetDetails(), {0,0}, 0, props.finalFontSize);
         ImVec2 size = TextRenderer::CalculateSize(element);
         outBelowElements.push_back({LayoutElementKey::Details, size});
     }
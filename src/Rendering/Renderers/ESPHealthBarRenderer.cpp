@@ -11,7 +11,6 @@
 #include "../Utils/EntityVisualsCalculator.h"
 #include "../Data/TextElement.h"
 #include "TextRenderer.h"
-#include "../../Core/AppState.h"
 
 namespace kx {
 
@@ -41,15 +40,15 @@ namespace kx {
         float barWidth,
         float healthPercent,
         unsigned int entityColor,
-        float fadeAlpha) {
+        float fadeAlpha,
+        float globalOpacity) {
         float hpWidth = barWidth * Clamp01(healthPercent);
         ImVec2 hMin = barMin;
         ImVec2 hMax(barMin.x + hpWidth, barMax.y);
 
         // Apply global opacity to health bar fill
-        const auto& settings = AppState::Get().GetSettings();
         unsigned int healthAlpha =
-	        static_cast<unsigned int>(RenderingLayout::STANDALONE_HEALTH_BAR_HEALTH_ALPHA * fadeAlpha * settings.appearance.globalOpacity + 0.5f);
+	        static_cast<unsigned int>(RenderingLayout::STANDALONE_HEALTH_BAR_HEALTH_ALPHA * fadeAlpha * globalOpacity + 0.5f);
         unsigned int baseColorNoA = (entityColor & 0x00FFFFFF);
         ImU32 baseHealthColor = (baseColorNoA) | (ClampAlpha(healthAlpha) << 24);
 
@@ -57,7 +56,7 @@ namespace kx {
     }
 
     void ESPHealthBarRenderer::DrawHealOverlay(ImDrawList* dl, const EntityRenderContext& context, const ImVec2& barMin, float barWidth, float barHeight,
-	    float fadeAlpha)
+	    float fadeAlpha, float globalOpacity)
     {
         const auto& anim = context.healthBarAnim;
         if (anim.healOverlayAlpha <= 0.0f) return;
@@ -70,8 +69,7 @@ namespace kx {
         ImVec2 oMax(barMin.x + barWidth * currentPercent, barMin.y + barHeight);
 
         // Apply global opacity to heal overlay
-        const auto& settings = AppState::Get().GetSettings();
-        ImU32 color = ApplyAlphaToColor(ESPBarColors::HEAL_OVERLAY, anim.healOverlayAlpha * fadeAlpha * settings.appearance.globalOpacity);
+        ImU32 color = ApplyAlphaToColor(ESPBarColors::HEAL_OVERLAY, anim.healOverlayAlpha * fadeAlpha * globalOpacity);
         DrawFilledRect(dl, oMin, oMax, color, RenderingLayout::STANDALONE_HEALTH_BAR_BG_ROUNDING);
     }
 
@@ -80,7 +78,8 @@ namespace kx {
         const ImVec2& barMin,
         float barWidth,
         float barHeight,
-        float fadeAlpha) {
+        float fadeAlpha,
+        float globalOpacity) {
         const auto& anim = context.healthBarAnim;
         if (anim.healFlashAlpha <= 0.0f) return;
 
@@ -92,9 +91,8 @@ namespace kx {
         ImVec2 fMax(barMin.x + barWidth * currentPercent, barMin.y + barHeight);
 
         // Apply global opacity to heal flash
-        const auto& settings = AppState::Get().GetSettings();
         ImU32 flashColor = IM_COL32( // keep runtime alpha because it varies per frame
-            255, 255, 255, static_cast<int>(anim.healFlashAlpha * 255 * fadeAlpha * settings.appearance.globalOpacity));
+            255, 255, 255, static_cast<int>(anim.healFlashAlpha * 255 * fadeAlpha * globalOpacity));
         flashColor = (ESPBarColors::HEAL_FLASH & 0x00FFFFFF) | (flashColor & 0xFF000000);
         DrawFilledRect(dl, fMin, fMax, flashColor, RenderingLayout::STANDALONE_HEALTH_BAR_BG_ROUNDING);
     }
@@ -104,7 +102,8 @@ namespace kx {
         const ImVec2& barMin,
         float barWidth,
         float barHeight,
-        float fadeAlpha) {
+        float fadeAlpha,
+        float globalOpacity) {
         const auto& anim = context.healthBarAnim;
         // Exit if there's nothing to draw OR if the fade animation is complete
         if (anim.damageAccumulatorPercent <= 0.0f || anim.damageAccumulatorAlpha <= 0.0f) return;
@@ -121,8 +120,7 @@ namespace kx {
         unsigned int a = (base >> 24) & 0xFF;
         // --- THIS IS THE FIX ---
         // Multiply by the overall bar fade AND the specific accumulator fade animation alpha AND global opacity
-        const auto& settings = AppState::Get().GetSettings();
-        unsigned int finalA = static_cast<unsigned int>(a * fadeAlpha * anim.damageAccumulatorAlpha * settings.appearance.globalOpacity + 0.5f);
+        unsigned int finalA = static_cast<unsigned int>(a * fadeAlpha * anim.damageAccumulatorAlpha * globalOpacity + 0.5f);
         base = (base & 0x00FFFFFF) | (ClampAlpha(finalA) << 24);
         DrawFilledRect(dl, oMin, oMax, base, RenderingLayout::STANDALONE_HEALTH_BAR_BG_ROUNDING);
     }
@@ -132,7 +130,8 @@ namespace kx {
         const ImVec2& barMin,
         float barWidth,
         float barHeight,
-        float fadeAlpha) {
+        float fadeAlpha,
+        float globalOpacity) {
         const auto& anim = context.healthBarAnim;
         if (anim.damageFlashAlpha <= 0.0f) return;
 
@@ -146,8 +145,7 @@ namespace kx {
 
         ImU32 flashColor = ESPBarColors::DAMAGE_FLASH;
         // Apply global opacity to damage flash
-        const auto& settings = AppState::Get().GetSettings();
-        unsigned int a = static_cast<unsigned int>(255 * anim.damageFlashAlpha * fadeAlpha * settings.appearance.globalOpacity);
+        unsigned int a = static_cast<unsigned int>(255 * anim.damageFlashAlpha * fadeAlpha * globalOpacity);
         flashColor = (flashColor & 0x00FFFFFF) | (ClampAlpha(a) << 24);
         DrawFilledRect(dl, fMin, fMax, flashColor, RenderingLayout::STANDALONE_HEALTH_BAR_BG_ROUNDING);
     }
@@ -160,7 +158,8 @@ namespace kx {
         const ImVec2& barMax,
         float barWidth,
         float barHeight,
-        float fadeAlpha)
+        float fadeAlpha,
+        float globalOpacity)
     {
         const RenderableEntity* entity = context.entity;
         if (!entity || entity->maxHealth <= 0) return;
@@ -172,9 +171,8 @@ namespace kx {
         const float barrierPercent = animatedBarrier / entity->maxHealth;
 
         // Apply global opacity to barrier overlay
-        const auto& settings = AppState::Get().GetSettings();
-        const ImU32 barrierColor = ApplyAlphaToColor(ESPBarColors::BARRIER_FILL, fadeAlpha * settings.appearance.globalOpacity);
-        const ImU32 overflowOutlineColor = ApplyAlphaToColor(ESPBarColors::BARRIER_SEPARATOR, fadeAlpha * settings.appearance.globalOpacity);
+        const ImU32 barrierColor = ApplyAlphaToColor(ESPBarColors::BARRIER_FILL, fadeAlpha * globalOpacity);
+        const ImU32 overflowOutlineColor = ApplyAlphaToColor(ESPBarColors::BARRIER_SEPARATOR, fadeAlpha * globalOpacity);
 
         // 1) Barrier inside the remaining health segment, left to right
         if (healthPercent < 1.0f) {
@@ -220,7 +218,8 @@ namespace kx {
         unsigned int entityColor,
         float barWidth,
         float barHeight,
-        float fontSize) { 
+        float fontSize,
+        float globalOpacity) { 
         
         const auto& anim = context.healthBarAnim;
         float fadeAlpha = ((entityColor >> 24) & 0xFF) / 255.0f;
@@ -233,9 +232,8 @@ namespace kx {
         ImVec2 barMax(barTopLeftPosition.x + barWidth, barTopLeftPosition.y + barHeight);
 
         // Background
-        const auto& settings = AppState::Get().GetSettings();
         unsigned int bgAlpha =
-            static_cast<unsigned int>(RenderingLayout::STANDALONE_HEALTH_BAR_BG_ALPHA * fadeAlpha * settings.appearance.globalOpacity + 0.5f);
+            static_cast<unsigned int>(RenderingLayout::STANDALONE_HEALTH_BAR_BG_ALPHA * fadeAlpha * globalOpacity + 0.5f);
         drawList->AddRectFilled(barMin,
             barMax,
             IM_COL32(0, 0, 0, ClampAlpha(bgAlpha)),
@@ -243,7 +241,7 @@ namespace kx {
 
         // Alive vs Dead specialized rendering
         if (context.entity->currentHealth > 0) {
-            RenderAliveState(drawList, context, barMin, barMax, barWidth, entityColor, fadeAlpha, fontSize);
+            RenderAliveState(drawList, context, barMin, barMax, barWidth, entityColor, fadeAlpha, fontSize, globalOpacity);
         }
         else {
             RenderDeadState(drawList, context, barMin, barMax, barWidth, fadeAlpha);
@@ -251,7 +249,7 @@ namespace kx {
 
 		// Outer stroke settings
         const float outset = 1.0f; // 1 px outside, feels "harder" and more separated
-        unsigned int outerA = static_cast<unsigned int>(RenderingLayout::STANDALONE_HEALTH_BAR_BORDER_ALPHA * fadeAlpha * settings.appearance.globalOpacity + 0.5f);
+        unsigned int outerA = static_cast<unsigned int>(RenderingLayout::STANDALONE_HEALTH_BAR_BORDER_ALPHA * fadeAlpha * globalOpacity + 0.5f);
         ImU32 outerDark = IM_COL32(0, 0, 0, ClampAlpha(outerA));
 
         // Hostile
@@ -290,7 +288,8 @@ namespace kx {
         float barWidth,
         unsigned int entityColor,
         float fadeAlpha,
-        float fontSize) {
+        float fontSize,
+        float globalOpacity) {
         const RenderableEntity* entity = context.entity;
         if (!entity || entity->maxHealth <= 0) return;
 
@@ -300,20 +299,20 @@ namespace kx {
         // 1. Base health fill
         DrawHealthBase(drawList, barMin, barMax, barWidth, 
             context.entity->maxHealth > 0 ? (context.entity->currentHealth / context.entity->maxHealth) : 0.0f, 
-            entityColor, fadeAlpha);
+            entityColor, fadeAlpha, globalOpacity);
 
         // 2. Healing overlays
-        DrawHealOverlay(drawList, context, barMin, barWidth, barHeight, fadeAlpha);
-        DrawHealFlash(drawList, context, barMin, barWidth, barHeight, fadeAlpha);
+        DrawHealOverlay(drawList, context, barMin, barWidth, barHeight, fadeAlpha, globalOpacity);
+        DrawHealFlash(drawList, context, barMin, barWidth, barHeight, fadeAlpha, globalOpacity);
 
         // 3. Accumulated damage
-        DrawAccumulatedDamage(drawList, context, barMin, barWidth, barHeight, fadeAlpha);
+        DrawAccumulatedDamage(drawList, context, barMin, barWidth, barHeight, fadeAlpha, globalOpacity);
 
         // 4. Damage flash
-        DrawDamageFlash(drawList, context, barMin, barWidth, barHeight, fadeAlpha);
+        DrawDamageFlash(drawList, context, barMin, barWidth, barHeight, fadeAlpha, globalOpacity);
 
         // 5. Barrier overlay (drawn last, on top of everything)
-        DrawBarrierOverlay(drawList, context, barMin, barMax, barWidth, barHeight, fadeAlpha);
+        DrawBarrierOverlay(drawList, context, barMin, barMax, barWidth, barHeight, fadeAlpha, globalOpacity);
 
         // 6. Health Percentage Text (drawn last, on top of everything)
         if (context.renderHealthPercentage && context.entity->maxHealth > 0) {
@@ -381,16 +380,16 @@ namespace kx {
         float fadeAlpha,
         float barWidth,
         float barHeight,
-        float healthBarHeight) {
+        float healthBarHeight,
+        float globalOpacity) {
         if (energyPercent < 0.0f || energyPercent > 1.0f) return;
 
         ImVec2 barMin(barTopLeftPosition.x, barTopLeftPosition.y);
         ImVec2 barMax(barTopLeftPosition.x + barWidth, barTopLeftPosition.y + barHeight);
 
         // Background
-        const auto& settings = AppState::Get().GetSettings();
         unsigned int bgAlpha =
-            ClampAlpha(static_cast<unsigned int>(RenderingLayout::STANDALONE_HEALTH_BAR_BG_ALPHA * fadeAlpha * settings.appearance.globalOpacity + 0.5f));
+            ClampAlpha(static_cast<unsigned int>(RenderingLayout::STANDALONE_HEALTH_BAR_BG_ALPHA * fadeAlpha * globalOpacity + 0.5f));
         drawList->AddRectFilled(barMin,
             barMax,
             IM_COL32(0, 0, 0, bgAlpha),
@@ -403,7 +402,7 @@ namespace kx {
 
         ImU32 energyColor = ESPColors::ENERGY_BAR;
         float colorA = ((energyColor >> 24) & 0xFF) / 255.0f;
-        ImU32 finalColor = ApplyAlphaToColor(energyColor, colorA * fadeAlpha * settings.appearance.globalOpacity);
+        ImU32 finalColor = ApplyAlphaToColor(energyColor, colorA * fadeAlpha * globalOpacity);
 
         DrawFilledRect(drawList, eMin, eMax, finalColor, RenderingLayout::STANDALONE_HEALTH_BAR_BG_ROUNDING);
     }
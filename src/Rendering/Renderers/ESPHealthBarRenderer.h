@@ -21,7 +21,8 @@ namespace kx {
             unsigned int entityColor,
             float barWidth,
             float barHeight,
-            float fontSize);
+            float fontSize,
+            float globalOpacity);
 
         static void RenderStandaloneEnergyBar(ImDrawList* drawList,
             const glm::vec2& barTopLeftPosition,
@@ -29,7 +30,8 @@ namespace kx {
             float fadeAlpha,
             float barWidth,
             float barHeight,
-            float healthBarHeight);
+            float healthBarHeight,
+            float globalOpacity);
 
     private:
         // --- Internal Specializations ---
@@ -40,7 +42,8 @@ namespace kx {
             float barWidth,
             unsigned int entityColor,
             float fadeAlpha,
-            float fontSize);
+            float fontSize,
+            float globalOpacity);
 
         // Add new helper for drawing text
         static void DrawHealthPercentageText(ImDrawList* dl, const ImVec2& barMin, const ImVec2& barMax, float healthPercent, float fontSize, float fadeAlpha);
@@ -70,30 +73,34 @@ namespace kx {
             float barWidth,
             float healthPercent,
             unsigned int entityColor,
-            float fadeAlpha);
+            float fadeAlpha,
+            float globalOpacity);
 
-        static void DrawHealOverlay(ImDrawList* dl, const EntityRenderContext& context, const ImVec2& barMin, float barWidth, float barHeight, float fadeAlpha);
+        static void DrawHealOverlay(ImDrawList* dl, const EntityRenderContext& context, const ImVec2& barMin, float barWidth, float barHeight, float fadeAlpha, float globalOpacity);
 
         static void DrawHealFlash(ImDrawList* dl,
             const EntityRenderContext& context,
             const ImVec2& barMin,
             float barWidth,
             float barHeight,
-            float fadeAlpha);
+            float fadeAlpha,
+            float globalOpacity);
 
         static void DrawAccumulatedDamage(ImDrawList* dl,
 			const EntityRenderContext& context,
             const ImVec2& barMin,
             float barWidth,
             float barHeight,
-            float fadeAlpha);
+            float fadeAlpha,
+            float globalOpacity);
 
         static void DrawDamageFlash(ImDrawList* dl,
             const EntityRenderContext& context,
             const ImVec2& barMin,
             float barWidth,
             float barHeight,
-            float fadeAlpha);
+            float fadeAlpha,
+            float globalOpacity);
 
         static void DrawBarrierOverlay(ImDrawList* dl,
             const EntityRenderContext& context,
@@ -101,7 +108,8 @@ namespace kx {
             const ImVec2& barMax,
             float barWidth,
             float barHeight,
-            float fadeAlpha);
+            float fadeAlpha,
+            float globalOpacity);
 
 
     };
@@ -7,6 +7,7 @@
 #include "../Utils/ESPConstants.h"
 #include "../../../libs/ImGui/imgui.h"
 #include "../Utils/ESPMath.h"
+#include "../Utils/ScreenProjection.h"
 #include "../Data/EntityRenderContext.h"
 #include "../../Core/AppState.h"
 
@@ -55,44 +56,52 @@ void ESPShapeRenderer::RenderGadgetSphere(ImDrawList* drawList, const EntityRend
         const float finalLineThickness = std::clamp(GadgetSphere::BASE_THICKNESS * scale, GadgetSphere::MIN_THICKNESS, GadgetSphere::MAX_THICKNESS);
 
         // --- Project points with camera-facing information ---
+        // All three rings go through one batched projection; the gyroscope is only drawn if every point is visible
+        thread_local std::vector<glm::vec3> worldPoints;
+        thread_local std::vector<glm::vec2> projectedPoints;
+        thread_local std::vector<uint8_t> pointVisible;
+        const size_t ringSize = localRingXY.size();
+        worldPoints.clear();
+        for (const auto* ring : { &localRingXY, &localRingXZ, &localRingYZ }) {
+            for (const auto& point : *ring) {
+                worldPoints.push_back(entityContext.position + point);
+            }
+        }
+        projectedPoints.resize(worldPoints.size());
+        pointVisible.resize(worldPoints.size());
+        ScreenProjection::ProjectPoints(camera.GetViewProjectionMatrix(), worldPoints, screenWidth, screenHeight,
+                                        projectedPoints.data(), pointVisible.data());
+        const bool projection_ok = std::find(pointVisible.begin(), pointVisible.end(), 0) == pointVisible.end();
+
         std::vector<ImVec2> screenRingXY, screenRingXZ, screenRingYZ;
         std::vector<float> facingRingXY, facingRingXZ, facingRingYZ;
-        bool projection_ok = true;
         
         // Get camera position once for all rings (optimization)
         glm::vec3 cameraPos = camera.GetCameraPosition();
         
-        auto project_ring_with_facing = [&](const std::vector<glm::vec3>& local_points, std::vector<ImVec2>& screen_points, std::vector<float>& facing_points) {
-            if (!projection_ok) return;
+        auto collect_ring_with_facing = [&](size_t ringIndex, const std::vector<glm::vec3>& local_points, std::vector<ImVec2>& screen_points, std::vector<float>& facing_points) {
             screen_points.reserve(local_points.size());
             facing_points.reserve(local_points.size());
             
-            for (const auto& point : local_points) {
-                glm::vec3 worldPoint = entityContext.position + point;
-                glm::vec2 sp;
+            for (size_t i = 0; i < local_points.size(); ++i) {
+                const size_t index = ringIndex * ringSize + i;
+                const glm::vec2& sp = projectedPoints[index];
+                screen_points.push_back(ImVec2(sp.x, sp.y));
                 
-                if (ESPMath::WorldToScreen(worldPoint, camera, screenWidth, screenHeight, sp)) {
-                    screen_points.push_back(ImVec2(sp.x, sp.y));
-                    
-                    // Calculate camera-facing factor using dot product
-                    glm::vec3 viewDir = glm::normalize(worldPoint - cameraPos);
-                    glm::vec3 outwardNormal = glm::normalize(point); // point is local offset from sphere center
-                    float facingFactor = glm::dot(outwardNormal, -viewDir);
-                    
-                    facing_points.push_back(facingFactor);
-                }
-                else { 
-                    projection_ok = false; 
-                    screen_points.clear(); 
-                    facing_points.clear(); 
-                    return; 
-                }
+                // Calculate camera-facing factor using dot product
+                glm::vec3 viewDir = glm::normalize(worldPoints[index] - cameraPos);
+                glm::vec3 outwardNormal = glm::normalize(local_points[i]); // point is local offset from sphere center
+                float facingFactor = glm::dot(outwardNormal, -viewDir);
+                
+                facing_points.push_back(facingFactor);
             }
         };
         
-        project_ring_with_facing(localRingXY, screenRingXY, facingRingXY);
-        project_ring_with_facing(localRingXZ, screenRingXZ, facingRingXZ);
-        project_ring_with_facing(localRingYZ, screenRingYZ, facingRingYZ);
+        if (projection_ok) {
+            collect_ring_with_facing(0, localRingXY, screenRingXY, facingRingXY);
+            collect_ring_with_facing(1, localRingXZ, screenRingXZ, facingRingXZ);
+            collect_ring_with_facing(2, localRingYZ, screenRingYZ, facingRingYZ);
+        }
 
         // --- Draw the 3D sphere with camera-facing rendering ---
         if (projection_ok) {
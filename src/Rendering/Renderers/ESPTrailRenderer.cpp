@@ -1,11 +1,11 @@
 #include "ESPTrailRenderer.h"
 #include "../Data/ESPData.h"
 #include "../Data/EntityRenderContext.h"
-#include "../Combat/CombatStateManager.h"
 #include "../Combat/CombatState.h"
 #include "../Utils/ESPMath.h"
+#include "../Utils/ScreenProjection.h"
 #include "ESPShapeRenderer.h"
-#include "../../Core/AppState.h"
+#include "../../Core/Settings.h"
 #include "../../Game/GameEnums.h"
 #include <algorithm>
 
@@ -23,9 +23,10 @@ namespace {
 void ESPTrailRenderer::RenderPlayerTrail(
     const FrameContext& context,
     const EntityRenderContext& entityContext,
-    const VisualProperties& props)
+    const VisualProperties& props,
+    std::span<const PositionHistoryPoint> history)
 {
-    const auto& settings = AppState::Get().GetSettings();
+    const auto& settings = context.settings;
     const auto& trailSettings = settings.playerESP.trails;
     
     if (!trailSettings.enabled) {
@@ -39,7 +40,7 @@ void ESPTrailRenderer::RenderPlayerTrail(
     }
     
     const uint64_t now = context.now;
-    std::vector<PositionHistoryPoint> worldPoints = CollectTrailPoints(context, entityContext, now);
+    std::vector<PositionHistoryPoint> worldPoints = CollectTrailPoints(entityContext, history, now);
     
     if (worldPoints.size() < 2) {
         return;
@@ -59,19 +60,18 @@ void ESPTrailRenderer::RenderPlayerTrail(
 }
 
 std::vector<PositionHistoryPoint> ESPTrailRenderer::CollectTrailPoints(
-    const FrameContext& context,
     const EntityRenderContext& entityContext,
+    std::span<const PositionHistoryPoint> history,
     uint64_t now)
 {
-    const EntityCombatState* state = context.stateManager.GetState(entityContext.entity->address);
-    if (!state || state->positionHistory.empty()) {
+    if (history.empty()) {
         return {};
     }
     
     std::vector<PositionHistoryPoint> worldPoints;
-    worldPoints.reserve(state->positionHistory.size() + 1);
+    worldPoints.reserve(history.size() + 1);
 
-    for (const auto& historyPoint : state->positionHistory) {
+    for (const auto& historyPoint : history) {
         worldPoints.push_back(historyPoint);
     }
 
@@ -79,14 +79,14 @@ std::vector<PositionHistoryPoint> ESPTrailRenderer::CollectTrailPoints(
         return {};
     }
 
-    const auto& P0 = state->positionHistory.back();
+    const auto& P0 = history.back();
     if ((now - P0.timestamp) < 150) {
         PositionHistoryPoint interpolatedHeadPoint;
         interpolatedHeadPoint.position = entityContext.entity->position;
         interpolatedHeadPoint.timestamp = now;
         
-        if (state->positionHistory.size() >= 2) {
-            const auto& P1 = state->positionHistory[state->positionHistory.size() - 2];
+        if (history.size() >= 2) {
+            const auto& P1 = history[history.size() - 2];
             
             if (now >= P0.timestamp && P0.timestamp > P1.timestamp) {
                 uint64_t timeDiff = P0.timestamp - P1.timestamp;
@@ -188,7 +188,7 @@ void ESPTrailRenderer::ProjectAndRenderTrail(
     float globalOpacity,
     bool renderTeleportConnections)
 {
-    const auto& settings = AppState::Get().GetSettings();
+    const auto& settings = context.settings;
     const float maxDuration = settings.playerESP.trails.maxDuration;
     const uint64_t now = context.now;
 
@@ -203,11 +203,23 @@ void ESPTrailRenderer::ProjectAndRenderTrail(
         };
         std::vector<ScreenPoint> screenPoints;
         screenPoints.reserve(segment.size());
-        
+
+        // Project the whole segment in one batched pass
+        thread_local std::vector<glm::vec3> worldPositions;
+        thread_local std::vector<glm::vec2> projected;
+        thread_local std::vector<uint8_t> visible;
+        worldPositions.clear();
         for (const auto& worldPoint : segment) {
-            glm::vec2 screenPos;
-            if (ESPMath::WorldToScreen(worldPoint.position, context.camera, context.screenWidth, context.screenHeight, screenPos)) {
-                screenPoints.push_back({ImVec2(screenPos.x, screenPos.y), worldPoint.timestamp});
+            worldPositions.push_back(worldPoint.position);
+        }
+        projected.resize(segment.size());
+        visible.resize(segment.size());
+        ScreenProjection::ProjectPoints(context.camera.GetViewProjectionMatrix(), worldPositions,
+                                        context.screenWidth, context.screenHeight, projected.data(), visible.data());
+
+        for (size_t i = 0; i < segment.size(); ++i) {
+            if (visible[i]) {
+                screenPoints.push_back({ImVec2(projected[i].x, projected[i].y), segment[i].timestamp});
             }
         }
 
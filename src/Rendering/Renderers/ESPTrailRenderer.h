@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <vector>
 #include <glm/vec3.hpp>
 #include "../../../libs/ImGui/imgui.h"
@@ -18,15 +19,20 @@ struct TrailSegmentData {
 
 class ESPTrailRenderer {
 public:
+    /**
+     * @brief Render the movement trail for a player
+     * @param history Position history captured into the frame snapshot by the pipeline worker
+     */
     static void RenderPlayerTrail(
         const FrameContext& context,
         const EntityRenderContext& entityContext,
-        const VisualProperties& props);
+        const VisualProperties& props,
+        std::span<const PositionHistoryPoint> history);
 
 private:
     static std::vector<PositionHistoryPoint> CollectTrailPoints(
-        const FrameContext& context,
         const EntityRenderContext& entityContext,
+        std::span<const PositionHistoryPoint> history,
         uint64_t now);
 
     static TrailSegmentData GenerateSmoothTrail(
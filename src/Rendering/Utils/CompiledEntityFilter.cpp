@@ -0,0 +1,44 @@
+#include "CompiledEntityFilter.h"
+
+#include "EntityFilter.h"
+
+namespace kx {
+namespace Filtering {
+
+void CompiledEntityFilter::Compile(const Settings& settings) {
+    using namespace CompiledFilterLayout;
+
+    m_categoryMask = 0;
+    auto setCategory = [&](ESPEntityType type, bool enabled) {
+        if (enabled) m_categoryMask |= static_cast<uint8_t>(1u << static_cast<uint32_t>(type));
+    };
+    setCategory(ESPEntityType::Player, settings.playerESP.enabled);
+    setCategory(ESPEntityType::NPC, settings.npcESP.enabled);
+    setCategory(ESPEntityType::Gadget, settings.objectESP.enabled);
+    setCategory(ESPEntityType::AttackTarget, settings.objectESP.enabled && settings.objectESP.showAttackTargetList);
+
+    // Every slot is filled from EntityFilter itself, so the table can't drift from it
+    m_characterBits.reset();
+    for (uint32_t attitudeSlot = 0; attitudeSlot < ATTITUDE_SLOTS; ++attitudeSlot) {
+        const auto attitude = static_cast<Game::Attitude>(attitudeSlot);
+        const bool player = EntityFilter::ShouldRenderPlayer(attitude, settings.playerESP);
+
+        for (uint32_t rankSlot = 0; rankSlot < RANK_SLOTS; ++rankSlot) {
+            const auto rank = static_cast<Game::CharacterRank>(rankSlot);
+            m_characterBits.set(CharacterBit(ESPEntityType::Player, attitude, rank), player);
+            m_characterBits.set(CharacterBit(ESPEntityType::NPC, attitude, rank),
+                                EntityFilter::ShouldRenderNpc(attitude, rank, settings.npcESP));
+        }
+    }
+
+    m_gadgetMask = 0;
+    for (uint32_t slot = 0; slot < GADGET_SLOTS; ++slot) {
+        if (EntityFilter::ShouldRenderGadget(static_cast<Game::GadgetType>(slot), settings.objectESP)) {
+            m_gadgetMask |= 1u << slot;
+        }
+    }
+    m_showUnknownGadgets = settings.objectESP.showUnknown;
+}
+
+} // namespace Filtering
+} // namespace kx
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include "../../Game/GameEnums.h"
+#include "../Data/ESPEntityTypes.h"
+
+namespace kx {
+
+struct Settings;
+
+namespace Filtering {
+
+/**
+ * @brief Slot layout of CompiledEntityFilter's bitsets
+ */
+namespace CompiledFilterLayout {
+    constexpr size_t CHARACTER_TYPES = 2;  // Player, NPC
+    constexpr size_t ATTITUDE_SLOTS = 5;   // The four attitudes plus one shared by out-of-range values
+    constexpr size_t RANK_SLOTS = static_cast<size_t>(Game::CharacterRank::End) + 1; // End is the out-of-range slot
+    constexpr size_t GADGET_SLOTS = 32;    // Every GadgetType value; larger values share the unknown verdict
+}
+
+/**
+ * @brief EntityFilter's verdicts for one settings state, precomputed for every enum value
+ *
+ * Compile() evaluates the nested setting branches of EntityFilter once, into a bitset over
+ * (character type x attitude x rank) and a mask over GadgetType, plus one category bit per
+ * entity type. Filtering an entity is then a single bit test instead of a walk through the
+ * settings. Verdicts match EntityFilter for every value, including out-of-range ones.
+ */
+class CompiledEntityFilter {
+public:
+    void Compile(const Settings& settings);
+
+    /**
+     * @brief Whether the entity type's ESP category is switched on at all
+     */
+    bool IsCategoryEnabled(ESPEntityType type) const {
+        return (m_categoryMask >> static_cast<uint32_t>(type)) & 1;
+    }
+
+    bool ShouldRenderPlayer(Game::Attitude attitude) const {
+        return m_characterBits.test(CharacterBit(ESPEntityType::Player, attitude, Game::CharacterRank::Normal));
+    }
+
+    bool ShouldRenderNpc(Game::Attitude attitude, Game::CharacterRank rank) const {
+        return m_characterBits.test(CharacterBit(ESPEntityType::NPC, attitude, rank));
+    }
+
+    bool ShouldRenderGadget(Game::GadgetType type) const {
+        const uint32_t slot = static_cast<uint32_t>(type);
+        return slot < CompiledFilterLayout::GADGET_SLOTS ? ((m_gadgetMask >> slot) & 1) : m_showUnknownGadgets;
+    }
+
+private:
+    static size_t CharacterBit(ESPEntityType type, Game::Attitude attitude, Game::CharacterRank rank) {
+        using namespace CompiledFilterLayout;
+        const size_t typeSlot = type == ESPEntityType::Player ? 0 : 1;
+        const size_t attitudeSlot = std::min<size_t>(static_cast<uint32_t>(attitude), ATTITUDE_SLOTS - 1);
+        const size_t rankSlot = std::min<size_t>(static_cast<uint32_t>(rank), RANK_SLOTS - 1); // Negative ranks wrap high
+        return (typeSlot * ATTITUDE_SLOTS + attitudeSlot) * RANK_SLOTS + rankSlot;
+    }
+
+    std::bitset<CompiledFilterLayout::CHARACTER_TYPES * CompiledFilterLayout::ATTITUDE_SLOTS * CompiledFilterLayout::RANK_SLOTS> m_characterBits;
+    uint32_t m_gadgetMask = 0;
+    bool m_showUnknownGadgets = false;
+    uint8_t m_categoryMask = 0;
+};
+
+} // namespace Filtering
+} // namespace kx
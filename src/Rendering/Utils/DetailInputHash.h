@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace kx {
+
+/**
+ * @brief FNV-1a over the values a set of detail lines is formatted from
+ *
+ * The details builders feed it exactly the fields and flags their Build functions read, so
+ * two entities (or one entity on two updates) with the same hash get the same lines.
+ * Floats are hashed by bit pattern; only add scalars, never structs with padding.
+ */
+class DetailInputHash {
+public:
+    template<typename T>
+        requires std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>
+    DetailInputHash& Add(T value) {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        return AddBytes(bytes, sizeof(T));
+    }
+
+    DetailInputHash& Add(std::string_view text) {
+        Add(text.size());
+        return AddBytes(text.data(), text.size());
+    }
+
+    uint64_t Get() const { return m_hash; }
+
+private:
+    DetailInputHash& AddBytes(const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            m_hash ^= bytes[i];
+            m_hash *= 0x100000001b3ull;
+        }
+        return *this;
+    }
+
+    uint64_t m_hash = 0xcbf29ce484222325ull;
+};
+
+} // namespace kx
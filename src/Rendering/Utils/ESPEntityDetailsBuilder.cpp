@@ -1,6 +1,7 @@
 #include "ESPEntityDetailsBuilder.h"
 #include "ESPFormatting.h"
 #include "ESPConstants.h"
+#include "DetailInputHash.h"
 #include "../../Game/GameEnums.h"
 #include <format>
 #include <sstream>
@@ -17,8 +18,9 @@ std::vector<ColoredDetail> ESPEntityDetailsBuilder::BuildNpcDetails(const Render
 
     details.reserve(12); // Future-proof: generous reserve for adding new fields
 
-    if (!npc->name.empty()) {
-        details.push_back({ "NPC: " + npc->name, ESPColors::DEFAULT_TEXT });
+    const std::string_view npcName = GetEntityNameArena().Resolve(npc->name);
+    if (!npcName.empty()) {
+        details.push_back({ "NPC: " + std::string(npcName), ESPColors::DEFAULT_TEXT });
     }
 
     if (settings.showDetailLevel && npc->level > 0) {
@@ -141,4 +143,119 @@ std::vector<ColoredDetail> ESPEntityDetailsBuilder::BuildAttackTargetDetails(con
     return details;
 }
 
+uint64_t ESPEntityDetailsBuilder::HashNpcDetailInputs(const RenderableNpc* npc, const NpcEspSettings& settings, bool showDebugAddresses) {
+    DetailInputHash hash;
+    hash.Add(ESPEntityType::NPC).Add(settings.renderDetails);
+    if (!settings.renderDetails) {
+        return hash.Get();
+    }
+
+    hash.Add(GetEntityNameArena().Resolve(npc->name));
+
+    hash.Add(settings.showDetailLevel);
+    if (settings.showDetailLevel) {
+        hash.Add(npc->level);
+    }
+
+    hash.Add(settings.showDetailHp);
+    if (settings.showDetailHp) {
+        hash.Add(npc->maxHealth > 0);
+        if (npc->maxHealth > 0) {
+            hash.Add(static_cast<int>(npc->currentHealth)).Add(static_cast<int>(npc->maxHealth));
+        }
+    }
+
+    hash.Add(settings.showDetailAttitude);
+    if (settings.showDetailAttitude) {
+        hash.Add(npc->attitude);
+    }
+
+    hash.Add(settings.showDetailRank);
+    if (settings.showDetailRank) {
+        hash.Add(npc->rank);
+    }
+
+    hash.Add(settings.showDetailPosition);
+    if (settings.showDetailPosition) {
+        hash.Add(npc->position.x).Add(npc->position.y).Add(npc->position.z);
+    }
+
+    hash.Add(showDebugAddresses);
+    if (showDebugAddresses) {
+        hash.Add(npc->address);
+    }
+    return hash.Get();
+}
+
+uint64_t ESPEntityDetailsBuilder::HashGadgetDetailInputs(const RenderableGadget* gadget, const ObjectEspSettings& settings, bool showDebugAddresses) {
+    DetailInputHash hash;
+    hash.Add(ESPEntityType::Gadget).Add(settings.renderDetails);
+    if (!settings.renderDetails) {
+        return hash.Get();
+    }
+
+    hash.Add(settings.showDetailGadgetType);
+    if (settings.showDetailGadgetType) {
+        hash.Add(gadget->type);
+    }
+
+    hash.Add(settings.showDetailHealth);
+    if (settings.showDetailHealth) {
+        hash.Add(gadget->maxHealth > 0);
+        if (gadget->maxHealth > 0) {
+            hash.Add(static_cast<int>(gadget->currentHealth)).Add(static_cast<int>(gadget->maxHealth));
+        }
+    }
+
+    hash.Add(settings.showDetailResourceInfo);
+    if (settings.showDetailResourceInfo) {
+        hash.Add(gadget->type).Add(gadget->resourceType);
+    }
+
+    hash.Add(settings.showDetailGatherableStatus);
+    if (settings.showDetailGatherableStatus) {
+        hash.Add(gadget->isGatherable);
+    }
+
+    hash.Add(settings.showDetailPosition);
+    if (settings.showDetailPosition) {
+        hash.Add(gadget->position.x).Add(gadget->position.y).Add(gadget->position.z);
+    }
+
+    hash.Add(showDebugAddresses);
+    if (showDebugAddresses) {
+        hash.Add(gadget->address);
+    }
+    return hash.Get();
+}
+
+uint64_t ESPEntityDetailsBuilder::HashAttackTargetDetailInputs(const RenderableAttackTarget* attackTarget, const ObjectEspSettings& settings, bool showDebugAddresses) {
+    DetailInputHash hash;
+    hash.Add(ESPEntityType::AttackTarget).Add(settings.renderDetails);
+    if (!settings.renderDetails) {
+        return hash.Get();
+    }
+
+    hash.Add(settings.showDetailHealth);
+    if (settings.showDetailHealth) {
+        hash.Add(attackTarget->maxHealth > 0);
+        if (attackTarget->maxHealth > 0) {
+            hash.Add(static_cast<int>(attackTarget->currentHealth)).Add(static_cast<int>(attackTarget->maxHealth));
+        }
+    }
+
+    hash.Add(settings.showDetailPosition);
+    if (settings.showDetailPosition) {
+        hash.Add(attackTarget->position.x).Add(attackTarget->position.y).Add(attackTarget->position.z);
+    }
+
+    hash.Add(attackTarget->agentId);
+
+    hash.Add(showDebugAddresses);
+    if (showDebugAddresses) {
+        hash.Add(attackTarget->address);
+    }
+    return hash.Get();
+}
+
 } // namespace kx
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include "../Data/RenderableData.h"
 #include "../../Core/Settings.h"
@@ -41,6 +42,24 @@ public:
      * @return Vector of colored text details
      */
     static std::vector<ColoredDetail> BuildAttackTargetDetails(const RenderableAttackTarget* attackTarget, const ObjectEspSettings& settings, bool showDebugAddresses);
+
+    /**
+     * @brief Hash of exactly the values BuildNpcDetails reads for these arguments
+     *
+     * Equal hashes mean equal details, so callers can keep reusing lines they already built.
+     * Keep each Hash function in step with its Build function.
+     */
+    static uint64_t HashNpcDetailInputs(const RenderableNpc* npc, const NpcEspSettings& settings, bool showDebugAddresses);
+
+    /**
+     * @brief Hash of exactly the values BuildGadgetDetails reads for these arguments
+     */
+    static uint64_t HashGadgetDetailInputs(const RenderableGadget* gadget, const ObjectEspSettings& settings, bool showDebugAddresses);
+
+    /**
+     * @brief Hash of exactly the values BuildAttackTargetDetails reads for these arguments
+     */
+    static uint64_t HashAttackTargetDetailInputs(const RenderableAttackTarget* attackTarget, const ObjectEspSettings& settings, bool showDebugAddresses);
 };
 
 } // namespace kx
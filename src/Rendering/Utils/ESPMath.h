@@ -14,7 +14,9 @@ namespace ESPMath {
      * @param screenWidth The width of the screen/viewport.
      * @param screenHeight The height of the screen/viewport.
      * @param outScreenPos Output parameter for the calculated 2D screen position.
-     * @return True if the projected point is in front of the camera (Z <= 1.0), false otherwise.
+     * @return True if the projected point is in front of the camera and inside the view volume, false otherwise.
+     *
+     * For many points at once, use ScreenProjection::ProjectPoints with camera.GetViewProjectionMatrix().
      */
     bool WorldToScreen(const glm::vec3& worldPos, const Camera& camera, float screenWidth, float screenHeight, glm::vec2& outScreenPos);
 
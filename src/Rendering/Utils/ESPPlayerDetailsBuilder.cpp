@@ -1,6 +1,7 @@
 #include "ESPPlayerDetailsBuilder.h"
 #include "ESPFormatting.h"
 #include "ESPConstants.h"
+#include "DetailInputHash.h"
 #include "../../Game/GameEnums.h"
 #include "../../Game/Generated/StatData.h"
 #include "../../../libs/ImGui/imgui.h"
@@ -76,17 +77,83 @@ std::vector<ColoredDetail> ESPPlayerDetailsBuilder::BuildPlayerDetails(const Ren
     return details;
 }
 
+uint64_t ESPPlayerDetailsBuilder::HashPlayerDetailInputs(const RenderablePlayer* player, const PlayerEspSettings& settings, bool showDebugAddresses) {
+    DetailInputHash hash;
+    hash.Add(ESPEntityType::Player).Add(settings.renderDetails);
+    if (!settings.renderDetails) {
+        return hash.Get();
+    }
+
+    hash.Add(settings.showDetailLevel);
+    if (settings.showDetailLevel) {
+        hash.Add(player->level).Add(player->scaledLevel);
+    }
+
+    hash.Add(settings.showDetailProfession);
+    if (settings.showDetailProfession) {
+        hash.Add(player->profession);
+    }
+
+    hash.Add(settings.showDetailAttitude);
+    if (settings.showDetailAttitude) {
+        hash.Add(player->attitude);
+    }
+
+    hash.Add(settings.showDetailRace);
+    if (settings.showDetailRace) {
+        hash.Add(player->race);
+    }
+
+    hash.Add(settings.showDetailHp);
+    if (settings.showDetailHp) {
+        hash.Add(player->maxHealth > 0);
+        if (player->maxHealth > 0) {
+            hash.Add(static_cast<int>(player->currentHealth)).Add(static_cast<int>(player->maxHealth));
+        }
+    }
+
+    hash.Add(settings.showDetailEnergy);
+    if (settings.showDetailEnergy) {
+        hash.Add(player->maxEnergy > 0);
+        if (player->maxEnergy > 0) {
+            const int energyPercent = static_cast<int>((player->currentEnergy / player->maxEnergy) * 100.0f);
+            hash.Add(static_cast<int>(player->currentEnergy)).Add(static_cast<int>(player->maxEnergy)).Add(energyPercent);
+        }
+    }
+
+    hash.Add(settings.showDetailPosition);
+    if (settings.showDetailPosition) {
+        hash.Add(player->position.x).Add(player->position.y).Add(player->position.z);
+    }
+
+    hash.Add(showDebugAddresses);
+    if (showDebugAddresses) {
+        hash.Add(player->address);
+    }
+    return hash.Get();
+}
+
+uint64_t ESPPlayerDetailsBuilder::HashGearDetailInputs(const RenderablePlayer* player) {
+    DetailInputHash hash;
+    for (const GearSlotInfo& info : player->gear) {
+        hash.Add(info.IsEquipped());
+        if (info.IsEquipped()) {
+            hash.Add(info.statId).Add(info.rarity);
+        }
+    }
+    return hash.Get();
+}
+
 std::vector<CompactStatInfo> ESPPlayerDetailsBuilder::BuildCompactGearSummary(const RenderablePlayer* player) {
-    if (!player || player->gear.empty()) {
+    if (!player || !HasAnyGear(player->gear)) {
         return {};
     }
 
     // Use a map to group stats and find the highest rarity for each
     std::map<std::string, CompactStatInfo> statSummary;
     int totalItems = 0;
-    for (const auto& pair : player->gear) {
-        const GearSlotInfo& info = pair.second;
-        if (info.statId > 0) {
+    for (const GearSlotInfo& info : player->gear) {
+        if (info.IsEquipped() && info.statId > 0) {
             totalItems++;
             auto statIt = data::stat::DATA.find(info.statId);
             if (statIt != data::stat::DATA.end()) {
@@ -133,13 +200,12 @@ std::vector<CompactStatInfo> ESPPlayerDetailsBuilder::BuildCompactGearSummary(co
 
 std::map<data::ApiAttribute, int> ESPPlayerDetailsBuilder::BuildAttributeSummary(const RenderablePlayer* player) {
     std::map<data::ApiAttribute, int> attributeCounts;
-    if (!player || player->gear.empty()) {
+    if (!player || !HasAnyGear(player->gear)) {
         return attributeCounts;
     }
 
-    for (const auto& pair : player->gear) {
-        const GearSlotInfo& info = pair.second;
-        if (info.statId > 0) {
+    for (const GearSlotInfo& info : player->gear) {
+        if (info.IsEquipped() && info.statId > 0) {
             auto statIt = data::stat::DATA.find(info.statId);
             if (statIt != data::stat::DATA.end()) {
                 for (const auto& attr : statIt->second.attributes) {
@@ -206,7 +272,7 @@ std::vector<ColoredDetail> ESPPlayerDetailsBuilder::BuildGearDetails(const Rende
     std::vector<ColoredDetail> gearDetails;
     gearDetails.reserve(20); // Future-proof: generous reserve for all gear slots + extras
 
-    const std::vector<Game::EquipmentSlot> displayOrder = {
+    static constexpr Game::EquipmentSlot displayOrder[] = {
         // Armor
         Game::EquipmentSlot::Helm,
         Game::EquipmentSlot::Shoulders,
@@ -229,10 +295,10 @@ std::vector<ColoredDetail> ESPPlayerDetailsBuilder::BuildGearDetails(const Rende
     };
 
     for (const auto& slotEnum : displayOrder) {
-        auto gearIt = player->gear.find(slotEnum);
-        if (gearIt != player->gear.end()) {
-            const char* slotName = ESPFormatting::EquipmentSlotToString(gearIt->first);
-            const GearSlotInfo& info = gearIt->second;
+        const int gearIndex = GearLayout::IndexOf(slotEnum);
+        if (gearIndex >= 0 && player->gear[gearIndex].IsEquipped()) {
+            const char* slotName = ESPFormatting::EquipmentSlotToString(slotEnum);
+            const GearSlotInfo& info = player->gear[gearIndex];
             ImU32 rarityColor = ESPStyling::GetRarityColor(info.rarity);
 
             std::string statName = "No Stats";
@@ -253,14 +319,14 @@ std::vector<ColoredDetail> ESPPlayerDetailsBuilder::BuildGearDetails(const Rende
 }
 
 Game::ItemRarity ESPPlayerDetailsBuilder::GetHighestRarity(const RenderablePlayer* player) {
-    if (!player || player->gear.empty()) {
+    if (!player || !HasAnyGear(player->gear)) {
         return Game::ItemRarity::None;
     }
 
     Game::ItemRarity highestRarity = Game::ItemRarity::None;
-    for (const auto& pair : player->gear) {
-        if (pair.second.rarity > highestRarity) {
-            highestRarity = pair.second.rarity;
+    for (const GearSlotInfo& info : player->gear) {
+        if (info.IsEquipped() && info.rarity > highestRarity) {
+            highestRarity = info.rarity;
         }
     }
     return highestRarity;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <vector>
 #include "../Data/RenderableData.h"
@@ -33,6 +34,19 @@ public:
      */
     static std::vector<ColoredDetail> BuildGearDetails(const RenderablePlayer* player);
 
+    /**
+     * @brief Hash of exactly the values BuildPlayerDetails reads for these arguments
+     *
+     * Equal hashes mean equal details, so callers can keep reusing lines they already built.
+     * Keep each Hash function in step with its Build function.
+     */
+    static uint64_t HashPlayerDetailInputs(const RenderablePlayer* player, const PlayerEspSettings& settings, bool showDebugAddresses);
+
+    /**
+     * @brief Hash of exactly the values BuildGearDetails reads for this player
+     */
+    static uint64_t HashGearDetailInputs(const RenderablePlayer* player);
+
     /**
      * @brief Build compact gear summary showing stat names and counts
      * @param player The player entity to analyze
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include "../../Game/GameEnums.h"
 #include "../../libs/ImGui/imgui.h"
 #include "ESPConstants.h"
@@ -77,34 +80,49 @@ namespace ESPStyling {
         }
     }
 
+    /**
+     * @brief Base entity colors by [entity type][attitude], packed once so coloring is a single load
+     *
+     * The last attitude slot is shared by out-of-range values. Gadgets and attack targets use
+     * one color whatever their attitude.
+     */
+    namespace EntityPalette {
+        constexpr size_t ATTITUDE_SLOTS = 5;
+
+        constexpr ImU32 CHARACTER_COLORS[ATTITUDE_SLOTS] = {
+            ESPColors::NPC_FRIENDLY,    // Attitude::Friendly
+            ESPColors::NPC_HOSTILE,     // Attitude::Hostile
+            ESPColors::NPC_INDIFFERENT, // Attitude::Indifferent
+            ESPColors::NPC_NEUTRAL,     // Attitude::Neutral
+            ESPColors::NPC_UNKNOWN
+        };
+
+        constexpr ImU32 COLORS[4][ATTITUDE_SLOTS] = {
+            { CHARACTER_COLORS[0], CHARACTER_COLORS[1], CHARACTER_COLORS[2], CHARACTER_COLORS[3], CHARACTER_COLORS[4] }, // Player
+            { CHARACTER_COLORS[0], CHARACTER_COLORS[1], CHARACTER_COLORS[2], CHARACTER_COLORS[3], CHARACTER_COLORS[4] }, // NPC
+            { ESPColors::GADGET, ESPColors::GADGET, ESPColors::GADGET, ESPColors::GADGET, ESPColors::GADGET },           // Gadget
+            { ESPColors::GADGET, ESPColors::GADGET, ESPColors::GADGET, ESPColors::GADGET, ESPColors::GADGET }            // AttackTarget (same as gadgets)
+        };
+    }
+
+    inline ImU32 GetEntityColor(ESPEntityType type, Game::Attitude attitude) {
+        const size_t typeSlot = static_cast<size_t>(type);
+        if (typeSlot >= 4) {
+            return ESPColors::NPC_UNKNOWN; // Fallback
+        }
+        const size_t attitudeSlot = (std::min)(static_cast<size_t>(static_cast<uint32_t>(attitude)), EntityPalette::ATTITUDE_SLOTS - 1);
+        return EntityPalette::COLORS[typeSlot][attitudeSlot];
+    }
+
     inline ImU32 GetEntityColor(const RenderableEntity& entity) {
         switch (entity.entityType) {
-            case ESPEntityType::Player: {
-                const auto* p = static_cast<const RenderablePlayer*>(&entity);
-                switch (p->attitude) {
-                    case Game::Attitude::Hostile:     return ESPColors::NPC_HOSTILE;
-                    case Game::Attitude::Friendly:    return ESPColors::NPC_FRIENDLY;
-                    case Game::Attitude::Neutral:     return ESPColors::NPC_NEUTRAL;
-                    case Game::Attitude::Indifferent: return ESPColors::NPC_INDIFFERENT;
-                    default:                          return ESPColors::NPC_UNKNOWN;
-                }
-            }
-            case ESPEntityType::NPC: {
-                const auto* n = static_cast<const RenderableNpc*>(&entity);
-                 switch (n->attitude) {
-                    case Game::Attitude::Hostile:     return ESPColors::NPC_HOSTILE;
-                    case Game::Attitude::Friendly:    return ESPColors::NPC_FRIENDLY;
-                    case Game::Attitude::Neutral:     return ESPColors::NPC_NEUTRAL;
-                    case Game::Attitude::Indifferent: return ESPColors::NPC_INDIFFERENT;
-                    default:                          return ESPColors::NPC_UNKNOWN;
-                }
-            }
-            case ESPEntityType::Gadget:
-                return ESPColors::GADGET;
-            case ESPEntityType::AttackTarget:
-                return ESPColors::GADGET; // Use same color as gadgets
+            case ESPEntityType::Player:
+                return GetEntityColor(entity.entityType, static_cast<const RenderablePlayer*>(&entity)->attitude);
+            case ESPEntityType::NPC:
+                return GetEntityColor(entity.entityType, static_cast<const RenderableNpc*>(&entity)->attitude);
+            default:
+                return GetEntityColor(entity.entityType, Game::Attitude::Neutral);
         }
-        return ESPColors::NPC_UNKNOWN; // Fallback
     }
 
 } // namespace ESPStyling
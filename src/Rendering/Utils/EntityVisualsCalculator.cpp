@@ -17,19 +17,30 @@ namespace kx {
 std::optional<VisualProperties> EntityVisualsCalculator::Calculate(const RenderableEntity& entity,
                                                                    Camera& camera,
                                                                    float screenWidth,
-                                                                   float screenHeight) {
-    VisualProperties props;
-
+                                                                   float screenHeight,
+                                                                   const Settings& settings) {
     // 1. Check if entity is on screen
-    if (!IsEntityOnScreen(entity.position, camera, screenWidth, screenHeight, props.screenPos)) {
+    glm::vec2 screenPos;
+    if (!IsEntityOnScreen(entity.position, camera, screenWidth, screenHeight, screenPos)) {
         return std::nullopt; // Entity is not visible
     }
 
+    return Calculate(entity, screenPos, camera, screenWidth, screenHeight, settings);
+}
+
+std::optional<VisualProperties> EntityVisualsCalculator::Calculate(const RenderableEntity& entity,
+                                                                   const glm::vec2& screenPos,
+                                                                   Camera& camera,
+                                                                   float screenWidth,
+                                                                   float screenHeight,
+                                                                   const Settings& settings) {
+    VisualProperties props;
+    props.screenPos = screenPos;
+
     // Determine color based on entity type and attitude
     unsigned int color = ESPStyling::GetEntityColor(entity);
 
     // 2. Calculate distance-based fade alpha
-    const auto& settings = AppState::Get().GetSettings();
     props.distanceFadeAlpha = CalculateDistanceFadeAlpha(entity.gameplayDistance,
                                                          settings.distance.useDistanceLimit,
                                                          settings.distance.renderDistanceLimit);
@@ -42,20 +53,20 @@ std::optional<VisualProperties> EntityVisualsCalculator::Calculate(const Rendera
     props.fadedEntityColor = ESPShapeRenderer::ApplyAlphaToColor(color, props.distanceFadeAlpha);
 
     // 4. Calculate distance-based scale
-    props.scale = CalculateEntityScale(entity.visualDistance, entity.entityType);
+    props.scale = CalculateEntityScale(entity.visualDistance, entity.entityType, settings);
 
     // 5. Calculate rendering dimensions (box or circle)
     if (entity.entityType == ESPEntityType::Gadget || entity.entityType == ESPEntityType::AttackTarget) {
-        CalculateGadgetDimensions(entity, camera, screenWidth, screenHeight, props, props.scale);
+        CalculateGadgetDimensions(entity, camera, screenWidth, screenHeight, props, props.scale, settings);
     } else {
-        CalculatePlayerNPCDimensions(entity, camera, screenWidth, screenHeight, props, props.scale);
+        CalculatePlayerNPCDimensions(entity, camera, screenWidth, screenHeight, props, props.scale, settings);
     }
 
     // 6. Calculate adaptive alpha
     float normalizedDistance = 0.0f;
     props.finalAlpha = CalculateAdaptiveAlpha(entity.gameplayDistance, props.distanceFadeAlpha,
                                              settings.distance.useDistanceLimit, entity.entityType,
-                                             normalizedDistance);
+                                             normalizedDistance, settings);
 
     // Removed: Hostile players now fade naturally with distance for better depth perception
     // Red color + 2x text/health bars provide sufficient emphasis
@@ -64,8 +75,8 @@ std::optional<VisualProperties> EntityVisualsCalculator::Calculate(const Rendera
     props.fadedEntityColor = ESPShapeRenderer::ApplyAlphaToColor(props.fadedEntityColor, props.finalAlpha);
 
     // 7. Calculate scaled sizes with limits
-    EntityMultipliers multipliers = CalculateEntityMultipliers(entity);
-    CalculateFinalSizes(props, props.scale, multipliers);
+    EntityMultipliers multipliers = CalculateEntityMultipliers(entity, settings);
+    CalculateFinalSizes(props, props.scale, multipliers, settings);
 
     return props;
 }
@@ -87,9 +98,7 @@ bool EntityVisualsCalculator::IsEntityOnScreen(const glm::vec3& position, Camera
     return true;
 }
 
-float EntityVisualsCalculator::CalculateEntityScale(float visualDistance, ESPEntityType entityType) {
-    const auto& settings = AppState::Get().GetSettings();
-    
+float EntityVisualsCalculator::CalculateEntityScale(float visualDistance, ESPEntityType entityType, const Settings& settings) {
     // Calculate the effective distance, which only starts counting after the "dead zone"
     float effectiveDistance = (std::max)(0.0f, visualDistance - settings.scaling.scalingStartDistance);
 
@@ -130,9 +139,8 @@ float EntityVisualsCalculator::CalculateEntityScale(float visualDistance, ESPEnt
 }
 
 void EntityVisualsCalculator::CalculateEntityBoxDimensions(ESPEntityType entityType, float scale,
-                                                          float& outBoxWidth, float& outBoxHeight) {
-    const auto& settings = AppState::Get().GetSettings();
-    
+                                                          float& outBoxWidth, float& outBoxHeight,
+                                                          const Settings& settings) {
     switch (entityType) {
     case ESPEntityType::Player:
         outBoxHeight = settings.sizes.baseBoxHeight * scale;
@@ -264,10 +272,11 @@ void EntityVisualsCalculator::ApplyFallback2DBox(
     const RenderableEntity& entity,
     VisualProperties& props,
     float scale,
-    const glm::vec2& screenPos)
+    const glm::vec2& screenPos,
+    const Settings& settings)
 {
     float boxWidth, boxHeight;
-    CalculateEntityBoxDimensions(entity.entityType, scale, boxWidth, boxHeight);
+    CalculateEntityBoxDimensions(entity.entityType, scale, boxWidth, boxHeight, settings);
     props.boxMin = ImVec2(screenPos.x - boxWidth / 2, screenPos.y - boxHeight);
     props.boxMax = ImVec2(screenPos.x + boxWidth / 2, screenPos.y);
 }
@@ -278,10 +287,9 @@ void EntityVisualsCalculator::CalculateGadgetDimensions(
     float screenWidth,
     float screenHeight,
     VisualProperties& props,
-    float scale)
+    float scale,
+    const Settings& settings)
 {
-    const auto& settings = AppState::Get().GetSettings();
-    
     // Gadgets use circle rendering - calculate radius from base box width
     float baseRadius = settings.sizes.baseBoxWidth * EntitySizeRatios::GADGET_CIRCLE_RADIUS_RATIO;
     props.circleRadius = (std::max)(MinimumSizes::GADGET_MIN_WIDTH / 2.0f, baseRadius * scale);
@@ -339,7 +347,8 @@ void EntityVisualsCalculator::CalculatePlayerNPCDimensions(
     float screenWidth,
     float screenHeight,
     VisualProperties& props,
-    float scale)
+    float scale,
+    const Settings& settings)
 {
     // Get world-space dimensions - prefer physics dimensions if available
     float worldWidth, worldDepth, worldHeight;
@@ -371,7 +380,7 @@ void EntityVisualsCalculator::CalculatePlayerNPCDimensions(
     
     // Fallback to 2D method if 3D projection fails (edge cases)
     if (!boxValid) {
-        ApplyFallback2DBox(entity, props, scale, props.screenPos);
+        ApplyFallback2DBox(entity, props, scale, props.screenPos, settings);
     }
     
     // Calculate center from projected box
@@ -384,8 +393,7 @@ void EntityVisualsCalculator::CalculatePlayerNPCDimensions(
 
 float EntityVisualsCalculator::CalculateAdaptiveAlpha(float gameplayDistance, float distanceFadeAlpha,
                                                       bool useDistanceLimit, ESPEntityType entityType,
-                                                      float& outNormalizedDistance) {
-    const auto& settings = AppState::Get().GetSettings();
+                                                      float& outNormalizedDistance, const Settings& settings) {
     outNormalizedDistance = 0.0f; // Initialize output
     
     if (useDistanceLimit) {
@@ -513,13 +521,12 @@ float EntityVisualsCalculator::CalculateDistanceFadeAlpha(float distance, bool u
     }
 }
 
-EntityMultipliers EntityVisualsCalculator::CalculateEntityMultipliers(const RenderableEntity& entity) {
+EntityMultipliers EntityVisualsCalculator::CalculateEntityMultipliers(const RenderableEntity& entity, const Settings& settings) {
     EntityMultipliers multipliers;
     
     // Calculate hostile multiplier
     if (entity.entityType == ESPEntityType::Player) {
         const auto* player = static_cast<const RenderablePlayer*>(&entity);
-        const auto& settings = AppState::Get().GetSettings();
         if (player->attitude == Game::Attitude::Hostile) {
             multipliers.hostile = settings.playerESP.hostileBoostMultiplier;
         }
@@ -544,9 +551,8 @@ EntityMultipliers EntityVisualsCalculator::CalculateEntityMultipliers(const Rend
 
 void EntityVisualsCalculator::CalculateFinalSizes(VisualProperties& props, 
                                                  float scale,
-                                                 const EntityMultipliers& multipliers) {
-    const auto& settings = AppState::Get().GetSettings();
-    
+                                                 const EntityMultipliers& multipliers,
+                                                 const Settings& settings) {
     // Font size uses hostile multiplier (combat-critical: keep 2x for readability)
     props.finalFontSize = CalculateFinalSize(settings.sizes.baseFontSize, scale, settings.sizes.minFontSize, ScalingLimits::MAX_FONT_SIZE, multipliers.hostile);
     
@@ -9,6 +9,7 @@
 namespace kx {
     class Camera;
     struct RenderableEntity;
+    struct Settings;
 }
 
 namespace kx {
@@ -45,22 +46,36 @@ public:
      * @param camera Camera for world-to-screen projection
      * @param screenWidth Screen width in pixels
      * @param screenHeight Screen height in pixels
+     * @param settings Settings snapshot of this update
      * @return Visual properties if entity should be rendered, nullopt otherwise
      */
     static std::optional<VisualProperties> Calculate(const RenderableEntity& entity,
                                                      Camera& camera,
                                                      float screenWidth,
-                                                     float screenHeight);
+                                                     float screenHeight,
+                                                     const Settings& settings);
 
     /**
-     * @brief Calculate a font size multiplier for the damage number based on the damage value.
-     *        100,000 damage should result in a 2x multiplier.
-     * @param damageToDisplay The total damage value to display.
-     * @return A float multiplier for the font size.
+     * @brief Calculate visual properties for an entity already projected to the screen
+     *
+     * Same as Calculate(), for callers that ran IsEntityOnScreen() themselves (e.g. over
+     * the position column of an EntityTable).
+     *
+     * @param entity The entity to process
+     * @param screenPos Screen position from IsEntityOnScreen()
+     * @param camera Camera for world-to-screen projection of the box corners
+     * @param screenWidth Screen width in pixels
+     * @param screenHeight Screen height in pixels
+     * @param settings Settings snapshot of this update
+     * @return Visual properties if entity should be rendered, nullopt otherwise
      */
-    static float GetDamageNumberFontSizeMultiplier(float damageToDisplay);
+    static std::optional<VisualProperties> Calculate(const RenderableEntity& entity,
+                                                     const glm::vec2& screenPos,
+                                                     Camera& camera,
+                                                     float screenWidth,
+                                                     float screenHeight,
+                                                     const Settings& settings);
 
-private:
     /**
      * @brief Check if entity is on screen and calculate screen position
      * @param position World position
@@ -73,13 +88,23 @@ private:
     static bool IsEntityOnScreen(const glm::vec3& position, Camera& camera,
                                 float screenWidth, float screenHeight, glm::vec2& outScreenPos);
 
+    /**
+     * @brief Calculate a font size multiplier for the damage number based on the damage value.
+     *        100,000 damage should result in a 2x multiplier.
+     * @param damageToDisplay The total damage value to display.
+     * @return A float multiplier for the font size.
+     */
+    static float GetDamageNumberFontSizeMultiplier(float damageToDisplay);
+
+private:
     /**
      * @brief Calculate distance-based scale factor for entity rendering
      * @param visualDistance Visual distance from camera
      * @param entityType Type of entity (affects which scaling curve is used)
+     * @param settings Settings snapshot of this update
      * @return Clamped scale factor (between espMinScale and espMaxScale)
      */
-    static float CalculateEntityScale(float visualDistance, ESPEntityType entityType);
+    static float CalculateEntityScale(float visualDistance, ESPEntityType entityType, const Settings& settings);
 
     /**
      * @brief Calculate box dimensions for entity based on type and scale
@@ -87,9 +112,11 @@ private:
      * @param scale Scale factor
      * @param outBoxWidth Output box width
      * @param outBoxHeight Output box height
+     * @param settings Settings snapshot of this update
      */
     static void CalculateEntityBoxDimensions(ESPEntityType entityType, float scale,
-                                            float& outBoxWidth, float& outBoxHeight);
+                                            float& outBoxWidth, float& outBoxHeight,
+                                            const Settings& settings);
 
     /**
      * @brief Calculate 3D bounding box projection to screen space
@@ -136,7 +163,8 @@ private:
         const RenderableEntity& entity,
         VisualProperties& props,
         float scale,
-        const glm::vec2& screenPos);
+        const glm::vec2& screenPos,
+        const Settings& settings);
 
     /**
      * @brief Calculate gadget circle dimensions
@@ -147,7 +175,8 @@ private:
         float screenWidth,
         float screenHeight,
         VisualProperties& props,
-        float scale);
+        float scale,
+        const Settings& settings);
 
     /**
      * @brief Calculate player/NPC 3D bounding box dimensions
@@ -158,7 +187,8 @@ private:
         float screenWidth,
         float screenHeight,
         VisualProperties& props,
-        float scale);
+        float scale,
+        const Settings& settings);
 
     /**
      * @brief Calculate adaptive alpha based on rendering mode and entity type
@@ -167,11 +197,12 @@ private:
      * @param useDistanceLimit Whether distance limit mode is enabled
      * @param entityType Type of entity (adaptive alpha only applied to gadgets)
      * @param outNormalizedDistance Output normalized distance (0.0-1.0, for future LOD effects)
+     * @param settings Settings snapshot of this update
      * @return Final alpha value with atmospheric fading applied
      */
     static float CalculateAdaptiveAlpha(float gameplayDistance, float distanceFadeAlpha,
                                        bool useDistanceLimit, ESPEntityType entityType,
-                                       float& outNormalizedDistance);
+                                       float& outNormalizedDistance, const Settings& settings);
 
     // Helper methods for internal calculations
     static float GetRankMultiplier(Game::CharacterRank rank);
@@ -180,12 +211,13 @@ private:
     static float CalculateDistanceFadeAlpha(float distance, bool useDistanceLimit, float distanceLimit);
     
     // Multiplier calculation
-    static EntityMultipliers CalculateEntityMultipliers(const RenderableEntity& entity);
+    static EntityMultipliers CalculateEntityMultipliers(const RenderableEntity& entity, const Settings& settings);
     
     // Final sizes calculation
     static void CalculateFinalSizes(VisualProperties& props, 
                                    float scale,
-                                   const EntityMultipliers& multipliers);
+                                   const EntityMultipliers& multipliers,
+                                   const Settings& settings);
 };
 
 } // namespace kx
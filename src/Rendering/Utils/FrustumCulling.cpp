@@ -0,0 +1,162 @@
+#include "FrustumCulling.h"
+#include "SimdHelpers.h"
+
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define KX_CULLING_SIMD 1
+#include <immintrin.h>
+#else
+#define KX_CULLING_SIMD 0
+#endif
+
+// Identical verdicts need the scalar path compiled without fused multiply-adds (see ScreenProjection.cpp)
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace kx {
+
+    namespace FrustumCulling {
+
+        namespace {
+
+            static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "Kernels load positions as packed floats");
+
+            /**
+             * @brief Shared scalar body; the SSE kernel evaluates exactly these expressions
+             *
+             * The box is outside a plane when even its corner furthest along the normal is behind
+             * it: signed distance of the center plus the box's extent along the normal.
+             */
+            inline bool IsVisibleScalar(const Planes& planes, const glm::vec3& p, const glm::vec3& h) {
+                const float cx = p.x;
+                const float cy = p.y + h.y; // Boxes stand on the position
+                const float cz = p.z;
+
+                for (const glm::vec4& n : planes) {
+                    const float distance = (n.x * cx + n.y * cy) + (n.z * cz + n.w);
+                    const float extent = (std::fabs(n.x) * h.x + std::fabs(n.y) * h.y) + std::fabs(n.z) * h.z;
+                    if (distance + extent < 0.0f) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            size_t CullBoxesScalar(const Planes& planes, const glm::vec3* positions, const glm::vec3* halfExtents,
+                                   size_t count, uint8_t* outVisible) {
+                size_t visibleCount = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    const bool visible = IsVisibleScalar(planes, positions[i], halfExtents[i]);
+                    outVisible[i] = visible ? 1 : 0;
+                    visibleCount += visible ? 1 : 0;
+                }
+                return visibleCount;
+            }
+
+#if KX_CULLING_SIMD
+            size_t CullBoxesSse(const Planes& planes, const glm::vec3* positions, const glm::vec3* halfExtents,
+                                size_t count, uint8_t* outVisible) {
+                struct PlaneLanes {
+                    __m128 nx, ny, nz, w;
+                    __m128 ax, ay, az; // |normal|
+                };
+                PlaneLanes lanes[6];
+                for (size_t i = 0; i < planes.size(); ++i) {
+                    const glm::vec4& n = planes[i];
+                    lanes[i] = { _mm_set1_ps(n.x), _mm_set1_ps(n.y), _mm_set1_ps(n.z), _mm_set1_ps(n.w),
+                                 _mm_set1_ps(std::fabs(n.x)), _mm_set1_ps(std::fabs(n.y)), _mm_set1_ps(std::fabs(n.z)) };
+                }
+                const __m128 zero = _mm_setzero_ps();
+
+                size_t visibleCount = 0;
+                size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m128 px, py, pz, hx, hy, hz;
+                    Simd::LoadTransposed4(positions + i, px, py, pz);
+                    Simd::LoadTransposed4(halfExtents + i, hx, hy, hz);
+                    const __m128 cy = _mm_add_ps(py, hy);
+
+                    // Lanes start visible and lose it on the first plane they are fully behind.
+                    // The compare is "not less than zero" so NaN lanes stay visible, as in the scalar path.
+                    __m128 outside = _mm_setzero_ps();
+                    for (const PlaneLanes& plane : lanes) {
+                        const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(plane.nx, px), _mm_mul_ps(plane.ny, cy)),
+                                                           _mm_add_ps(_mm_mul_ps(plane.nz, pz), plane.w));
+                        const __m128 extent = _mm_add_ps(_mm_add_ps(_mm_mul_ps(plane.ax, hx), _mm_mul_ps(plane.ay, hy)),
+                                                         _mm_mul_ps(plane.az, hz));
+                        outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, extent), zero));
+                    }
+
+                    const int mask = ~_mm_movemask_ps(outside);
+                    for (int lane = 0; lane < 4; ++lane) {
+                        const uint8_t visible = static_cast<uint8_t>((mask >> lane) & 1);
+                        outVisible[i + lane] = visible;
+                        visibleCount += visible;
+                    }
+                }
+
+                return visibleCount + CullBoxesScalar(planes, positions + i, halfExtents + i, count - i, outVisible + i);
+            }
+#endif
+
+        } // anonymous namespace
+
+        Planes ExtractPlanes(const glm::mat4& viewProjection) {
+            // Gribb/Hartmann plane extraction for a D3D-style clip space (0 <= z <= w)
+            const glm::mat4& m = viewProjection;
+            const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+            const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+            const glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+            const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+            Planes planes = {
+                row3 + row0, // Left
+                row3 - row0, // Right
+                row3 + row1, // Bottom
+                row3 - row1, // Top
+                row2,        // Near
+                row3 - row2  // Far
+            };
+            for (glm::vec4& plane : planes) {
+                const float length = glm::length(glm::vec3(plane));
+                if (length > 0.0f) {
+                    plane /= length;
+                }
+            }
+            return planes;
+        }
+
+        bool IsBoxVisible(const Planes& planes, const glm::vec3& position, const glm::vec3& halfExtents) {
+            return IsVisibleScalar(planes, position, halfExtents);
+        }
+
+        size_t CullBoxes(const Planes& planes, std::span<const glm::vec3> positions,
+                         const glm::vec3* halfExtents, uint8_t* outVisible) {
+#if KX_CULLING_SIMD
+            return CullBoxes(Kernel::Sse, planes, positions, halfExtents, outVisible);
+#else
+            return CullBoxes(Kernel::Scalar, planes, positions, halfExtents, outVisible);
+#endif
+        }
+
+        size_t CullBoxes(Kernel kernel, const Planes& planes, std::span<const glm::vec3> positions,
+                         const glm::vec3* halfExtents, uint8_t* outVisible) {
+#if KX_CULLING_SIMD
+            if (kernel == Kernel::Sse) {
+                return CullBoxesSse(planes, positions.data(), halfExtents, positions.size(), outVisible);
+            }
+#endif
+            return CullBoxesScalar(planes, positions.data(), halfExtents, positions.size(), outVisible);
+        }
+
+        bool IsKernelSupported(Kernel kernel) {
+            return kernel == Kernel::Scalar || KX_CULLING_SIMD;
+        }
+
+    } // namespace FrustumCulling
+
+} // namespace kx
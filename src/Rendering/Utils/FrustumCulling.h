@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include "glm.hpp"
+
+namespace kx {
+
+/**
+ * @brief Conservative view-frustum tests for entity bounding boxes
+ *
+ * A box is the axis-aligned world box an entity stands in: centered horizontally on its
+ * position, with its floor at the position and its ceiling 2 * halfExtents.y above it,
+ * the same box EntityVisualsCalculator projects. A box is culled only when it lies
+ * entirely on the outside of one of the six planes, so nothing whose position could
+ * project onto the screen is ever culled; boxes straddling a frustum corner may be kept.
+ *
+ * CullBoxes() tests four boxes per step with SSE and gives the same verdicts as
+ * IsBoxVisible(); NaN positions or extents are never culled.
+ */
+namespace FrustumCulling {
+
+    enum class Kernel : uint8_t {
+        Scalar,
+        Sse // 4 boxes per step; always available on x64
+    };
+
+    using Planes = std::array<glm::vec4, 6>;
+
+    /**
+     * @brief Frustum planes (left, right, bottom, top, near, far) of a D3D-style view-projection
+     *
+     * Normals are unit length and point into the frustum, so dot(normal, p) + w is the signed
+     * distance of p from the plane.
+     */
+    Planes ExtractPlanes(const glm::mat4& viewProjection);
+
+    /**
+     * @brief Test one box (the reference for CullBoxes)
+     */
+    bool IsBoxVisible(const Planes& planes, const glm::vec3& position, const glm::vec3& halfExtents);
+
+    /**
+     * @brief Test an array of boxes with the fastest supported kernel
+     *
+     * halfExtents and outVisible must hold positions.size() entries; outVisible[i] is 1 for
+     * boxes that may be visible and 0 for culled ones.
+     * @return Number of boxes that may be visible
+     */
+    size_t CullBoxes(const Planes& planes, std::span<const glm::vec3> positions,
+                     const glm::vec3* halfExtents, uint8_t* outVisible);
+
+    /**
+     * @brief Test an array of boxes with a specific kernel (must be supported)
+     */
+    size_t CullBoxes(Kernel kernel, const Planes& planes, std::span<const glm::vec3> positions,
+                     const glm::vec3* halfExtents, uint8_t* outVisible);
+
+    bool IsKernelSupported(Kernel kernel);
+
+} // namespace FrustumCulling
+
+} // namespace kx
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace kx {
 
 /**
@@ -94,6 +96,19 @@ namespace ExtractionCapacity {
     constexpr size_t ATTACK_TARGETS_RESERVE = 512; // Typical + buffer for attack targets
 }
 
+/**
+ * @brief Parallel extraction configuration
+ *
+ * The character and gadget lists are split into fixed-size index ranges that are
+ * extracted on a small work-stealing pool. Lists smaller than MIN_PARALLEL_CAPACITY
+ * are walked on the pipeline thread alone, where waking helpers costs more than it saves.
+ */
+namespace ExtractionParallelism {
+    constexpr size_t MAX_WORKERS = 4;               // Including the pipeline thread; also the pool shard count
+    constexpr uint32_t RANGE_SIZE = 512;            // Array slots per task (~9-15k slots -> 18-30 tasks)
+    constexpr uint32_t MIN_PARALLEL_CAPACITY = 1024;
+}
+
 /**
  * @brief Screen space culling constants
  * 
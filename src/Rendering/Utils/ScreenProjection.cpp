@@ -0,0 +1,253 @@
+#include "ScreenProjection.h"
+#include "SimdHelpers.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define KX_PROJECTION_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define KX_PROJECTION_SIMD 0
+#endif
+
+// MSVC compiles any intrinsic anywhere; GCC/Clang need the AVX2 kernel marked for that ISA
+#if KX_PROJECTION_SIMD && (defined(__GNUC__) || defined(__clang__))
+#define KX_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define KX_TARGET_AVX2
+#endif
+
+// Bit-for-bit agreement needs the scalar path compiled without fused multiply-adds.
+// MSVC's /fp:precise doesn't contract; GCC and Clang may when the target has FMA.
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace kx {
+
+    namespace ScreenProjection {
+
+        namespace {
+
+            static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "Kernels load positions as packed floats");
+            static_assert(sizeof(glm::vec2) == 2 * sizeof(float), "Kernels store screen positions as packed floats");
+
+            /**
+             * @brief Shared scalar body; every kernel evaluates exactly these expressions
+             */
+            inline bool ProjectScalar(const glm::mat4& m, const glm::vec3& p, float screenWidth, float screenHeight, glm::vec2& out) {
+                // Row i of the matrix times (p, 1), summed in pairs so the vector kernels can match it
+                const float clipX = (m[0][0] * p.x + m[1][0] * p.y) + (m[2][0] * p.z + m[3][0]);
+                const float clipY = (m[0][1] * p.x + m[1][1] * p.y) + (m[2][1] * p.z + m[3][1]);
+                const float clipZ = (m[0][2] * p.x + m[1][2] * p.y) + (m[2][2] * p.z + m[3][2]);
+                const float clipW = (m[0][3] * p.x + m[1][3] * p.y) + (m[2][3] * p.z + m[3][3]);
+
+                // Behind the camera
+                if (!(clipW > 0.0f)) {
+                    return false;
+                }
+
+                const float ndcX = clipX / clipW;
+                const float ndcY = clipY / clipW;
+                const float ndcZ = clipZ / clipW;
+                if (!(ndcX >= -1.0f && ndcX <= 1.0f && ndcY >= -1.0f && ndcY <= 1.0f && ndcZ >= 0.0f && ndcZ <= 1.0f)) {
+                    return false;
+                }
+
+                out.x = (screenWidth * (ndcX + 1.0f)) * 0.5f;
+                out.y = screenHeight * (1.0f - (ndcY + 1.0f) * 0.5f); // Flip Y for screen coordinates
+                return true;
+            }
+
+            void ProjectPointsScalar(const glm::mat4& m, const glm::vec3* positions, size_t count,
+                                     float screenWidth, float screenHeight, glm::vec2* outScreen, uint8_t* outVisible) {
+                for (size_t i = 0; i < count; ++i) {
+                    glm::vec2 screen(0.0f);
+                    outVisible[i] = ProjectScalar(m, positions[i], screenWidth, screenHeight, screen) ? 1 : 0;
+                    outScreen[i] = screen;
+                }
+            }
+
+#if KX_PROJECTION_SIMD
+            void ProjectPointsSse(const glm::mat4& m, const glm::vec3* positions, size_t count,
+                                  float screenWidth, float screenHeight, glm::vec2* outScreen, uint8_t* outVisible) {
+                __m128 rows[4][4];
+                for (int row = 0; row < 4; ++row) {
+                    for (int col = 0; col < 4; ++col) rows[row][col] = _mm_set1_ps(m[col][row]);
+                }
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 one = _mm_set1_ps(1.0f);
+                const __m128 minusOne = _mm_set1_ps(-1.0f);
+                const __m128 half = _mm_set1_ps(0.5f);
+                const __m128 width = _mm_set1_ps(screenWidth);
+                const __m128 height = _mm_set1_ps(screenHeight);
+
+                auto clip = [&](const __m128 (&r)[4], __m128 x, __m128 y, __m128 z) {
+                    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(r[0], x), _mm_mul_ps(r[1], y)),
+                                      _mm_add_ps(_mm_mul_ps(r[2], z), r[3]));
+                };
+
+                size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m128 x, y, z;
+                    Simd::LoadTransposed4(positions + i, x, y, z);
+
+                    const __m128 clipW = clip(rows[3], x, y, z);
+                    const __m128 ndcX = _mm_div_ps(clip(rows[0], x, y, z), clipW);
+                    const __m128 ndcY = _mm_div_ps(clip(rows[1], x, y, z), clipW);
+                    const __m128 ndcZ = _mm_div_ps(clip(rows[2], x, y, z), clipW);
+
+                    __m128 visible = _mm_cmpgt_ps(clipW, zero);
+                    visible = _mm_and_ps(visible, _mm_and_ps(_mm_cmpge_ps(ndcX, minusOne), _mm_cmple_ps(ndcX, one)));
+                    visible = _mm_and_ps(visible, _mm_and_ps(_mm_cmpge_ps(ndcY, minusOne), _mm_cmple_ps(ndcY, one)));
+                    visible = _mm_and_ps(visible, _mm_and_ps(_mm_cmpge_ps(ndcZ, zero), _mm_cmple_ps(ndcZ, one)));
+
+                    const __m128 screenX = _mm_and_ps(_mm_mul_ps(_mm_mul_ps(width, _mm_add_ps(ndcX, one)), half), visible);
+                    const __m128 screenY = _mm_and_ps(_mm_mul_ps(height, _mm_sub_ps(one, _mm_mul_ps(_mm_add_ps(ndcY, one), half))), visible);
+
+                    float* out = &outScreen[i].x;
+                    _mm_storeu_ps(out, _mm_unpacklo_ps(screenX, screenY));
+                    _mm_storeu_ps(out + 4, _mm_unpackhi_ps(screenX, screenY));
+
+                    const int mask = _mm_movemask_ps(visible);
+                    for (int lane = 0; lane < 4; ++lane) outVisible[i + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+                }
+
+                ProjectPointsScalar(m, positions + i, count - i, screenWidth, screenHeight, outScreen + i, outVisible + i);
+            }
+
+            KX_TARGET_AVX2
+            void ProjectPointsAvx2(const glm::mat4& m, const glm::vec3* positions, size_t count,
+                                   float screenWidth, float screenHeight, glm::vec2* outScreen, uint8_t* outVisible) {
+                __m256 rows[4][4];
+                for (int row = 0; row < 4; ++row) {
+                    for (int col = 0; col < 4; ++col) rows[row][col] = _mm256_set1_ps(m[col][row]);
+                }
+                const __m256 zero = _mm256_setzero_ps();
+                const __m256 one = _mm256_set1_ps(1.0f);
+                const __m256 minusOne = _mm256_set1_ps(-1.0f);
+                const __m256 half = _mm256_set1_ps(0.5f);
+                const __m256 width = _mm256_set1_ps(screenWidth);
+                const __m256 height = _mm256_set1_ps(screenHeight);
+
+                size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    __m128 xLow, yLow, zLow, xHigh, yHigh, zHigh;
+                    Simd::LoadTransposed4(positions + i, xLow, yLow, zLow);
+                    Simd::LoadTransposed4(positions + i + 4, xHigh, yHigh, zHigh);
+                    const __m256 x = _mm256_set_m128(xHigh, xLow);
+                    const __m256 y = _mm256_set_m128(yHigh, yLow);
+                    const __m256 z = _mm256_set_m128(zHigh, zLow);
+
+                    __m256 clipRow[4];
+                    for (int row = 0; row < 4; ++row) {
+                        clipRow[row] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(rows[row][0], x), _mm256_mul_ps(rows[row][1], y)),
+                                                     _mm256_add_ps(_mm256_mul_ps(rows[row][2], z), rows[row][3]));
+                    }
+                    const __m256 clipW = clipRow[3];
+                    const __m256 ndcX = _mm256_div_ps(clipRow[0], clipW);
+                    const __m256 ndcY = _mm256_div_ps(clipRow[1], clipW);
+                    const __m256 ndcZ = _mm256_div_ps(clipRow[2], clipW);
+
+                    // Ordered, quiet compares: NaN lanes come out invisible, as in the scalar path
+                    __m256 visible = _mm256_cmp_ps(clipW, zero, _CMP_GT_OQ);
+                    visible = _mm256_and_ps(visible, _mm256_and_ps(_mm256_cmp_ps(ndcX, minusOne, _CMP_GE_OQ), _mm256_cmp_ps(ndcX, one, _CMP_LE_OQ)));
+                    visible = _mm256_and_ps(visible, _mm256_and_ps(_mm256_cmp_ps(ndcY, minusOne, _CMP_GE_OQ), _mm256_cmp_ps(ndcY, one, _CMP_LE_OQ)));
+                    visible = _mm256_and_ps(visible, _mm256_and_ps(_mm256_cmp_ps(ndcZ, zero, _CMP_GE_OQ), _mm256_cmp_ps(ndcZ, one, _CMP_LE_OQ)));
+
+                    const __m256 screenX = _mm256_and_ps(_mm256_mul_ps(_mm256_mul_ps(width, _mm256_add_ps(ndcX, one)), half), visible);
+                    const __m256 screenY = _mm256_and_ps(_mm256_mul_ps(height, _mm256_sub_ps(one, _mm256_mul_ps(_mm256_add_ps(ndcY, one), half))), visible);
+
+                    // Unpacks interleave within each 128-bit lane; the permutes put the points back in order
+                    const __m256 pairsLow = _mm256_unpacklo_ps(screenX, screenY);  // p0 p1 | p4 p5
+                    const __m256 pairsHigh = _mm256_unpackhi_ps(screenX, screenY); // p2 p3 | p6 p7
+                    float* out = &outScreen[i].x;
+                    _mm256_storeu_ps(out, _mm256_permute2f128_ps(pairsLow, pairsHigh, 0x20));
+                    _mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(pairsLow, pairsHigh, 0x31));
+
+                    const int mask = _mm256_movemask_ps(visible);
+                    for (int lane = 0; lane < 8; ++lane) outVisible[i + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+                }
+
+                ProjectPointsScalar(m, positions + i, count - i, screenWidth, screenHeight, outScreen + i, outVisible + i);
+            }
+
+            bool DetectAvx2() {
+#if defined(_MSC_VER)
+                int info[4];
+                __cpuid(info, 0);
+                if (info[0] < 7) return false;
+
+                // The OS must save YMM state as well as the CPU supporting AVX
+                __cpuid(info, 1);
+                const bool osSavesState = (info[2] & (1 << 27)) != 0;
+                const bool avx = (info[2] & (1 << 28)) != 0;
+                if (!osSavesState || !avx || (_xgetbv(0) & 0x6) != 0x6) return false;
+
+                __cpuidex(info, 7, 0);
+                return (info[1] & (1 << 5)) != 0;
+#else
+                return __builtin_cpu_supports("avx2");
+#endif
+            }
+#endif // KX_PROJECTION_SIMD
+
+        } // anonymous namespace
+
+        bool ProjectPoint(const glm::mat4& viewProjection, const glm::vec3& worldPos,
+                          float screenWidth, float screenHeight, glm::vec2& outScreenPos) {
+            return ProjectScalar(viewProjection, worldPos, screenWidth, screenHeight, outScreenPos);
+        }
+
+        bool IsKernelSupported(Kernel kernel) {
+            switch (kernel) {
+            case Kernel::Scalar: return true;
+#if KX_PROJECTION_SIMD
+            case Kernel::Sse: return true;
+            case Kernel::Avx2: {
+                static const bool supported = DetectAvx2();
+                return supported;
+            }
+#else
+            case Kernel::Sse:
+            case Kernel::Avx2: return false;
+#endif
+            }
+            return false;
+        }
+
+        Kernel GetBestKernel() {
+            static const Kernel best = IsKernelSupported(Kernel::Avx2) ? Kernel::Avx2
+                                     : IsKernelSupported(Kernel::Sse) ? Kernel::Sse
+                                     : Kernel::Scalar;
+            return best;
+        }
+
+        void ProjectPoints(const glm::mat4& viewProjection, std::span<const glm::vec3> positions,
+                           float screenWidth, float screenHeight, glm::vec2* outScreen, uint8_t* outVisible) {
+            ProjectPoints(GetBestKernel(), viewProjection, positions, screenWidth, screenHeight, outScreen, outVisible);
+        }
+
+        void ProjectPoints(Kernel kernel, const glm::mat4& viewProjection, std::span<const glm::vec3> positions,
+                           float screenWidth, float screenHeight, glm::vec2* outScreen, uint8_t* outVisible) {
+            switch (kernel) {
+#if KX_PROJECTION_SIMD
+            case Kernel::Avx2:
+                ProjectPointsAvx2(viewProjection, positions.data(), positions.size(), screenWidth, screenHeight, outScreen, outVisible);
+                return;
+            case Kernel::Sse:
+                ProjectPointsSse(viewProjection, positions.data(), positions.size(), screenWidth, screenHeight, outScreen, outVisible);
+                return;
+#endif
+            default:
+                ProjectPointsScalar(viewProjection, positions.data(), positions.size(), screenWidth, screenHeight, outScreen, outVisible);
+                return;
+            }
+        }
+
+    } // namespace ScreenProjection
+
+} // namespace kx
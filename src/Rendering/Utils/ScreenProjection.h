@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include "glm.hpp"
+
+namespace kx {
+
+/**
+ * @brief World-to-screen projection through a precomputed view-projection matrix
+ *
+ * ProjectPoint() is the reference for one point. ProjectPoints() runs the same arithmetic,
+ * in the same order and without fused multiply-adds, over whole arrays four (SSE) or eight
+ * (AVX2) points at a time, so every kernel produces bit-identical results to the scalar path.
+ *
+ * A point is visible when it is in front of the camera and its normalized device
+ * coordinates are inside [-1,1] x [-1,1] x [0,1]; NaN coordinates are never visible.
+ */
+namespace ScreenProjection {
+
+    enum class Kernel : uint8_t {
+        Scalar,
+        Sse,   // 4 points per step; always available on x64
+        Avx2   // 8 points per step; used when the CPU and OS support it
+    };
+
+    /**
+     * @brief Project one point
+     * @return True if the point is visible; outScreenPos is left untouched otherwise
+     */
+    bool ProjectPoint(const glm::mat4& viewProjection, const glm::vec3& worldPos,
+                      float screenWidth, float screenHeight, glm::vec2& outScreenPos);
+
+    /**
+     * @brief Project an array of points with the fastest supported kernel
+     *
+     * outScreen and outVisible must hold positions.size() entries. outVisible[i] is 1 for
+     * visible points and 0 otherwise; outScreen[i] is (0,0) for points that aren't visible.
+     */
+    void ProjectPoints(const glm::mat4& viewProjection, std::span<const glm::vec3> positions,
+                       float screenWidth, float screenHeight, glm::vec2* outScreen, uint8_t* outVisible);
+
+    /**
+     * @brief Project an array of points with a specific kernel (must be supported)
+     */
+    void ProjectPoints(Kernel kernel, const glm::mat4& viewProjection, std::span<const glm::vec3> positions,
+                       float screenWidth, float screenHeight, glm::vec2* outScreen, uint8_t* outVisible);
+
+    bool IsKernelSupported(Kernel kernel);
+
+    /**
+     * @brief The kernel ProjectPoints() uses, detected once
+     */
+    Kernel GetBestKernel();
+
+} // namespace ScreenProjection
+
+} // namespace kx
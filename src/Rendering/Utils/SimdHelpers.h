@@ -0,0 +1,37 @@
+#pragma once
+
+#include "glm.hpp"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+
+namespace kx {
+namespace Simd {
+
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "Kernels load positions as packed floats");
+
+    /**
+     * @brief Load four packed vec3s and transpose them into x, y and z lanes
+     */
+    inline void LoadTransposed4(const glm::vec3* p, __m128& x, __m128& y, __m128& z) {
+        const float* f = &p->x;
+        const __m128 a = _mm_loadu_ps(f);     // x0 y0 z0 x1
+        const __m128 b = _mm_loadu_ps(f + 4); // y1 z1 x2 y2
+        const __m128 c = _mm_loadu_ps(f + 8); // z2 x3 y3 z3
+
+        const __m128 xHigh = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)); // x2 x2 x3 x3
+        x = _mm_shuffle_ps(a, xHigh, _MM_SHUFFLE(2, 0, 3, 0));
+
+        const __m128 yLow = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));  // y0 y0 y1 y1
+        const __m128 yHigh = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)); // y2 y2 y3 y3
+        y = _mm_shuffle_ps(yLow, yHigh, _MM_SHUFFLE(2, 0, 2, 0));
+
+        const __m128 zLow = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));  // z0 z0 z1 z1
+        const __m128 zHigh = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)); // z2 z2 z3 z3
+        z = _mm_shuffle_ps(zLow, zHigh, _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+} // namespace Simd
+} // namespace kx
+
+#endif
@@ -0,0 +1,261 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Rendering/Combat/CombatEvents.h"
+#include "../Rendering/Combat/DpsWindowStore.h"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The combat event stream and the rolling DPS windows it feeds, replaying a synthetic
+// high-frequency damage trace the way CombatStateManager does: publish every hit of an
+// update, drain the stream into DpsWindowStore, then query 1s/5s/30s for every entity each
+// 16ms frame. The baseline keeps a deque of raw hits per entity and sums the window on
+// every query. Runs outside the game:
+//   <test binary> "[benchmark]"
+
+using namespace kx;
+
+namespace {
+
+constexpr uint64_t FRAME_MS = 16;
+constexpr uint64_t TRACE_START = 1'000'000; // Arbitrary GetTickCount64-like origin
+
+constexpr DpsWindow ALL_WINDOWS[] = { DpsWindow::OneSecond, DpsWindow::FiveSeconds, DpsWindow::ThirtySeconds };
+
+/**
+ * @brief Recorded-style damage trace: per-entity hits sorted by time, with idle stretches
+ */
+struct DamageTrace {
+    uint32_t entityCount = 0;
+    uint64_t durationMs = 0;
+    std::vector<CombatEvent> hits; // Sorted by timestamp
+
+    DamageTrace(uint32_t entities, uint64_t duration) : entityCount(entities), durationMs(duration) {
+        std::mt19937_64 rng(77);
+        std::exponential_distribution<double> gap(1.0 / 20.0);    // ~50 hits/s while engaged
+        std::uniform_real_distribution<float> damage(50.0f, 3000.0f);
+        std::uniform_int_distribution<int> roll(0, 999);
+
+        for (uint32_t entity = 0; entity < entityCount; ++entity) {
+            double t = static_cast<double>(entity % 97);
+            while (t < static_cast<double>(durationMs)) {
+                CombatEvent hit;
+                hit.timestamp = TRACE_START + static_cast<uint64_t>(t);
+                hit.slot = entity;
+                hit.type = CombatEventType::Damage;
+                hit.amount = damage(rng);
+                hits.push_back(hit);
+
+                // Occasionally drop out of combat, sometimes for longer than the ring holds
+                const int r = roll(rng);
+                t += gap(rng) + (r < 2 ? 45000.0 : (r < 10 ? 3000.0 : 0.0));
+            }
+        }
+        std::stable_sort(hits.begin(), hits.end(), [](const CombatEvent& a, const CombatEvent& b) {
+            return a.timestamp < b.timestamp;
+        });
+    }
+};
+
+/**
+ * @brief Drains the stream into per-entity windows, as CombatStateManager::ConsumeEvents does
+ */
+struct WindowedAggregator {
+    CombatEventStream stream;
+    DpsWindowStore store;
+    std::vector<uint32_t> histories;
+
+    explicit WindowedAggregator(uint32_t entityCount) : histories(entityCount, DpsWindowStore::NO_HISTORY) {}
+
+    void Drain() {
+        CombatEvent event;
+        while (stream.TryPop(event)) {
+            uint32_t& history = histories[event.slot];
+            if (history == DpsWindowStore::NO_HISTORY) {
+                history = store.Acquire();
+            }
+            store.AddDamage(history, event.timestamp, event.amount);
+        }
+    }
+
+    double GetDamage(uint32_t entity, uint64_t now, DpsWindow window) const {
+        const uint32_t history = histories[entity];
+        return history == DpsWindowStore::NO_HISTORY ? 0.0 : store.GetDamage(history, now, window);
+    }
+};
+
+/**
+ * @brief Baseline: raw hits per entity, summed per query
+ */
+struct ScanningAggregator {
+    std::vector<std::deque<CombatEvent>> hits;
+
+    explicit ScanningAggregator(uint32_t entityCount) : hits(entityCount) {}
+
+    void Add(const CombatEvent& hit, uint64_t now) {
+        auto& entityHits = hits[hit.slot];
+        entityHits.push_back(hit);
+        const uint64_t longest = DpsWindowStore::GetWindowMs(DpsWindow::ThirtySeconds) + DpsWindowConfig::BUCKET_MS;
+        while (!entityHits.empty() && entityHits.front().timestamp + longest < now) {
+            entityHits.pop_front();
+        }
+    }
+
+    // Same bucket boundaries as DpsWindowStore, so the two agree exactly up to rounding
+    double GetDamage(uint32_t entity, uint64_t now, DpsWindow window) const {
+        const uint64_t nowBucket = now / DpsWindowConfig::BUCKET_MS;
+        const uint64_t firstBucket = nowBucket - DpsWindowStore::GetWindowMs(window) / DpsWindowConfig::BUCKET_MS + 1;
+        double damage = 0.0;
+        for (const CombatEvent& hit : hits[entity]) {
+            const uint64_t bucket = hit.timestamp / DpsWindowConfig::BUCKET_MS;
+            if (bucket >= firstBucket && bucket <= nowBucket) {
+                damage += hit.amount;
+            }
+        }
+        return damage;
+    }
+};
+
+/**
+ * @brief Replay the trace frame by frame, calling onFrame(now) after each frame's hits are in
+ */
+template<typename OnHit, typename OnFrame>
+void Replay(const DamageTrace& trace, OnHit&& onHit, OnFrame&& onFrame) {
+    size_t next = 0;
+    for (uint64_t now = TRACE_START; now <= TRACE_START + trace.durationMs; now += FRAME_MS) {
+        while (next < trace.hits.size() && trace.hits[next].timestamp <= now) {
+            onHit(trace.hits[next], now);
+            ++next;
+        }
+        onFrame(now);
+    }
+}
+
+} // anonymous namespace
+
+TEST_CASE("SPSC ring delivers every item in order across threads", "[combat-events]") {
+    SpscRing<uint64_t, 1024> ring;
+    constexpr uint64_t ITEM_COUNT = 1'000'000;
+
+    std::thread producer([&ring] {
+        for (uint64_t i = 0; i < ITEM_COUNT;) {
+            if (ring.TryPush(i)) ++i;
+            else std::this_thread::yield();
+        }
+    });
+
+    uint64_t expected = 0;
+    bool ordered = true;
+    while (expected < ITEM_COUNT) {
+        uint64_t item;
+        if (ring.TryPop(item)) {
+            ordered = ordered && item == expected;
+            ++expected;
+        }
+    }
+    producer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(ring.GetSize() == 0);
+}
+
+TEST_CASE("SPSC ring refuses pushes when full instead of overwriting", "[combat-events]") {
+    SpscRing<int, 4> ring;
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(ring.TryPush(i));
+    }
+    REQUIRE_FALSE(ring.TryPush(99));
+    REQUIRE(ring.GetSize() == 4);
+
+    int item = -1;
+    REQUIRE(ring.TryPop(item));
+    REQUIRE(item == 0);
+    REQUIRE(ring.TryPush(4));
+
+    for (int i = 1; i <= 4; ++i) {
+        REQUIRE(ring.TryPop(item));
+        REQUIRE(item == i);
+    }
+    REQUIRE_FALSE(ring.TryPop(item));
+}
+
+TEST_CASE("Rolling DPS windows match a scan of the raw damage trace", "[combat-events]") {
+    const DamageTrace trace(40, 120000);
+    WindowedAggregator windows(trace.entityCount);
+    ScanningAggregator scan(trace.entityCount);
+
+    uint64_t frame = 0;
+    size_t mismatches = 0;
+    Replay(trace,
+        [&](const CombatEvent& hit, uint64_t now) {
+            REQUIRE(windows.stream.TryPush(hit));
+            scan.Add(hit, now);
+        },
+        [&](uint64_t now) {
+            windows.Drain();
+            if (++frame % 7 != 0) return; // Scanning every frame is slow; primes sample all bucket phases
+            for (uint32_t entity = 0; entity < trace.entityCount; ++entity) {
+                for (DpsWindow window : ALL_WINDOWS) {
+                    const double expected = scan.GetDamage(entity, now, window);
+                    const double actual = windows.GetDamage(entity, now, window);
+                    if (actual != Catch::Approx(expected).epsilon(1e-9).margin(1e-3)) ++mismatches;
+                }
+            }
+        });
+
+    REQUIRE(mismatches == 0);
+    REQUIRE(windows.store.GetActiveCount() == trace.entityCount);
+}
+
+TEST_CASE("Rolling DPS divides by the window length", "[combat-events]") {
+    DpsWindowStore store;
+    const uint32_t history = store.Acquire();
+    store.AddDamage(history, 10'000, 1000.0f);
+    store.AddDamage(history, 10'600, 1000.0f);
+
+    REQUIRE(store.GetDps(history, 10'700, DpsWindow::OneSecond) == Catch::Approx(2000.0f));
+    REQUIRE(store.GetDps(history, 10'700, DpsWindow::FiveSeconds) == Catch::Approx(400.0f));
+    REQUIRE(store.GetDps(history, 11'300, DpsWindow::OneSecond) == Catch::Approx(1000.0f)); // First hit aged out
+    REQUIRE(store.GetDps(history, 50'000, DpsWindow::ThirtySeconds) == 0.0f);
+
+    store.Release(history);
+    REQUIRE(store.GetActiveCount() == 0);
+    REQUIRE(store.Acquire() == history); // Recycled, and cleared
+    REQUIRE(store.GetDamage(history, 10'700, DpsWindow::ThirtySeconds) == 0.0);
+}
+
+TEST_CASE("Combat event replay benchmark", "[.][benchmark]") {
+    const DamageTrace trace(200, 60000);
+    const std::string suffix = " (200 entities, 60s trace, " + std::to_string(trace.hits.size()) + " hits)";
+
+    BENCHMARK("Raw hit scan" + suffix) {
+        ScanningAggregator scan(trace.entityCount);
+        double sink = 0.0;
+        Replay(trace,
+            [&](const CombatEvent& hit, uint64_t now) { scan.Add(hit, now); },
+            [&](uint64_t now) {
+                for (uint32_t entity = 0; entity < trace.entityCount; ++entity) {
+                    for (DpsWindow window : ALL_WINDOWS) sink += scan.GetDamage(entity, now, window);
+                }
+            });
+        return sink;
+    };
+
+    BENCHMARK("Event stream + rolling windows" + suffix) {
+        WindowedAggregator windows(trace.entityCount);
+        double sink = 0.0;
+        Replay(trace,
+            [&](const CombatEvent& hit, uint64_t) { windows.stream.TryPush(hit); },
+            [&](uint64_t now) {
+                windows.Drain();
+                for (uint32_t entity = 0; entity < trace.entityCount; ++entity) {
+                    for (DpsWindow window : ALL_WINDOWS) sink += windows.GetDamage(entity, now, window);
+                }
+            });
+        return sink;
+    };
+}
@@ -0,0 +1,286 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Core/Settings/ESPSettings.h"
+#include "../Rendering/Combat/CombatStateManager.h"
+#include "../Rendering/Data/RenderableData.h"
+#include "../Rendering/Utils/CombatConstants.h"
+#include <cstdint>
+#include <vector>
+
+// CombatStateManager storage: states survive while their entity keeps being extracted,
+// disappear on the first Prune() after it isn't, and freed slots are handed out again.
+// Trail history is only recorded for entities the trail settings could render. Burst DPS
+// counts only the current burst's damage; the rolling windows fed by the combat event
+// stream serve fixed-window DPS.
+
+using namespace kx;
+
+namespace {
+
+RenderableEntity MakeEntity(uintptr_t address, float health) {
+    RenderableEntity entity;
+    entity.address = reinterpret_cast<const void*>(address);
+    entity.isValid = true;
+    entity.currentHealth = health;
+    entity.maxHealth = 1000.0f;
+    return entity;
+}
+
+void RunUpdate(CombatStateManager& manager, std::vector<RenderableEntity>& entities, uint64_t now) {
+    std::vector<RenderableEntity*> pointers;
+    for (auto& entity : entities) pointers.push_back(&entity);
+    manager.Update(pointers, TrailSettings{}, now);
+    manager.Prune();
+}
+
+} // anonymous namespace
+
+TEST_CASE("Combat state is kept for extracted entities and pruned for vanished ones", "[combat-state]") {
+    CombatStateManager manager;
+    std::vector<RenderableEntity> entities = {
+        MakeEntity(0x1000, 1000.0f), MakeEntity(0x2000, 1000.0f), MakeEntity(0x3000, 1000.0f)
+    };
+    RunUpdate(manager, entities, 100);
+    REQUIRE(manager.GetStateCount() == 3);
+
+    // 0x2000 takes damage while 0x3000 leaves
+    entities[1].currentHealth = 600.0f;
+    entities.pop_back();
+    RunUpdate(manager, entities, 200);
+
+    REQUIRE(manager.GetStateCount() == 2);
+    REQUIRE(manager.GetState(reinterpret_cast<const void*>(0x3000)) == nullptr);
+    const EntityCombatState* damaged = manager.GetState(reinterpret_cast<const void*>(0x2000));
+    REQUIRE(damaged != nullptr);
+    REQUIRE(damaged->accumulatedDamage == 400.0f);
+
+    // Extracted but without usable health: not processed, but not forgotten either
+    entities[1].isValid = false;
+    RunUpdate(manager, entities, 300);
+    REQUIRE(manager.GetState(reinterpret_cast<const void*>(0x2000)) == damaged);
+    REQUIRE(damaged->accumulatedDamage == 400.0f);
+
+    entities.clear();
+    RunUpdate(manager, entities, 400);
+    REQUIRE(manager.GetStateCount() == 0);
+}
+
+TEST_CASE("Pruned combat state slots are reused with a fresh state", "[combat-state]") {
+    CombatStateManager manager;
+    std::vector<RenderableEntity> entities = { MakeEntity(0x1000, 1000.0f) };
+    RunUpdate(manager, entities, 100);
+    entities[0].currentHealth = 500.0f;
+    RunUpdate(manager, entities, 200);
+    const EntityCombatState* first = manager.GetState(reinterpret_cast<const void*>(0x1000));
+
+    // Once pruned, a new entity takes over the freed slot without inheriting the old damage
+    entities.clear();
+    RunUpdate(manager, entities, 300);
+    entities = { MakeEntity(0x9000, 1000.0f) };
+    RunUpdate(manager, entities, 400);
+    const EntityCombatState* second = manager.GetState(reinterpret_cast<const void*>(0x9000));
+
+    REQUIRE(manager.GetStateCount() == 1);
+    REQUIRE(second == first);
+    REQUIRE(second->accumulatedDamage == 0.0f);
+    REQUIRE(second->lastKnownHealth == 1000.0f);
+}
+
+TEST_CASE("Prune keeps every state seen in the last update regardless of order", "[combat-state]") {
+    CombatStateManager manager;
+    std::vector<RenderableEntity> entities;
+    for (uintptr_t i = 1; i <= 64; ++i) entities.push_back(MakeEntity(i * 0x100, 1000.0f));
+    RunUpdate(manager, entities, 100);
+
+    // Keep every other entity, visiting them in reverse
+    std::vector<RenderableEntity> kept;
+    for (size_t i = entities.size(); i-- > 0;) {
+        if (i % 2 == 0) kept.push_back(entities[i]);
+    }
+    RunUpdate(manager, kept, 200);
+
+    REQUIRE(manager.GetStateCount() == 32);
+    for (size_t i = 0; i < entities.size(); ++i) {
+        const bool present = manager.GetState(entities[i].address) != nullptr;
+        REQUIRE(present == (i % 2 == 0));
+    }
+}
+
+TEST_CASE("Only players the trail settings can render record position history", "[combat-state]") {
+    TrailSettings trailSettings;
+    trailSettings.enabled = true;
+    trailSettings.displayMode = TrailDisplayMode::Hostile;
+
+    RenderablePlayer hostile;
+    RenderablePlayer friendly;
+    RenderableEntity npc = MakeEntity(0x3000, 1000.0f);
+    static_cast<RenderableEntity&>(hostile) = MakeEntity(0x1000, 1000.0f);
+    static_cast<RenderableEntity&>(friendly) = MakeEntity(0x2000, 1000.0f);
+    hostile.entityType = friendly.entityType = ESPEntityType::Player;
+    hostile.attitude = Game::Attitude::Hostile;
+    friendly.attitude = Game::Attitude::Friendly;
+    npc.entityType = ESPEntityType::NPC;
+
+    CombatStateManager manager;
+    const std::vector<RenderableEntity*> entities = { &hostile, &friendly, &npc };
+    for (uint64_t now = 100; now <= 300; now += 100) {
+        hostile.position.x = static_cast<float>(now);
+        friendly.position.x = static_cast<float>(now);
+        npc.position.x = static_cast<float>(now);
+        manager.Update(entities, trailSettings, now);
+        manager.Prune();
+    }
+
+    const EntityCombatState* hostileState = manager.GetState(hostile.address);
+    REQUIRE(hostileState->trail != TrailHistoryStore::NO_TRAIL);
+    REQUIRE(manager.GetTrailHistory().Size(hostileState->trail) == 3);
+    REQUIRE(manager.GetState(friendly.address)->trail == TrailHistoryStore::NO_TRAIL);
+    REQUIRE(manager.GetState(npc.address)->trail == TrailHistoryStore::NO_TRAIL);
+
+    // All players: the friendly one starts recording, the hostile one keeps its history
+    trailSettings.displayMode = TrailDisplayMode::All;
+    manager.Update(entities, trailSettings, 400);
+    REQUIRE(manager.GetTrailHistory().GetActiveCount() == 2);
+    REQUIRE(manager.GetTrailHistory().Size(hostileState->trail) == 3);
+
+    // Disabling trails hands every ring back
+    trailSettings.enabled = false;
+    manager.Update(entities, trailSettings, 500);
+    REQUIRE(manager.GetTrailHistory().GetActiveCount() == 0);
+}
+
+TEST_CASE("Idle entities skip the full pass while damage timers still fire on time", "[combat-state]") {
+    CombatStateManager manager;
+    std::vector<RenderableEntity> entities;
+    for (uintptr_t i = 1; i <= 100; ++i) entities.push_back(MakeEntity(i * 0x100, 1000.0f));
+
+    uint64_t now = 10000;
+    RunUpdate(manager, entities, now);
+    REQUIRE(manager.GetLastUpdateStats().processed == 100);
+
+    // One entity takes a hit; everyone else stays idle
+    now += 16;
+    const uint64_t hitTime = now;
+    entities[0].currentHealth = 700.0f;
+    RunUpdate(manager, entities, now);
+    REQUIRE(manager.GetLastUpdateStats().processed == 1);
+    REQUIRE(manager.GetLastUpdateStats().idle == 99);
+
+    // The burst flushes on the first update more than BURST_INACTIVITY_TIMEOUT_MS after the hit
+    const EntityCombatState* state = manager.GetState(entities[0].address);
+    uint64_t flushedAt = 0;
+    while (flushedAt == 0) {
+        now += 16;
+        RunUpdate(manager, entities, now);
+        if (state->flushAnimationStartTime != 0) {
+            flushedAt = now;
+            REQUIRE(manager.GetLastUpdateStats().timersFired == 1);
+            REQUIRE(manager.GetLastUpdateStats().processed == 1);
+        } else {
+            REQUIRE(manager.GetLastUpdateStats().processed == 0);
+        }
+    }
+    REQUIRE(flushedAt - hitTime > CombatEffects::BURST_INACTIVITY_TIMEOUT_MS);
+    REQUIRE(flushedAt - hitTime <= CombatEffects::BURST_INACTIVITY_TIMEOUT_MS + 16);
+    REQUIRE(state->damageToDisplay == 300.0f);
+
+    // And the accumulator resets once the fade has run
+    while (state->flushAnimationStartTime != 0) {
+        now += 16;
+        RunUpdate(manager, entities, now);
+    }
+    REQUIRE(now - flushedAt >= CombatEffects::DAMAGE_ACCUMULATOR_FADE_MS);
+    REQUIRE(now - flushedAt < CombatEffects::DAMAGE_ACCUMULATOR_FADE_MS + 16);
+    REQUIRE(state->accumulatedDamage == 0.0f);
+}
+
+TEST_CASE("Burst DPS tracks the current burst and resets on respawn", "[combat-state]") {
+    CombatStateManager manager;
+    manager.SetRollingDpsEnabled(true);
+    std::vector<RenderableEntity> entities = { MakeEntity(0x1000, 1000.0f) };
+    const void* id = entities[0].address;
+    RunUpdate(manager, entities, 10000);
+    REQUIRE(manager.GetBurstDps(id, 10000) == 0.0f);
+
+    // 200 damage every 500ms: two hits in, the burst is 500ms old and has taken 400
+    entities[0].currentHealth = 800.0f;
+    RunUpdate(manager, entities, 10000);
+    entities[0].currentHealth = 600.0f;
+    RunUpdate(manager, entities, 10500);
+    REQUIRE(manager.GetLastUpdateStats().events == 1);
+    REQUIRE(manager.GetBurstDps(id, 10500) == Catch::Approx(800.0f));
+    REQUIRE(manager.GetDps(id, 10500, DpsWindow::FiveSeconds) == Catch::Approx(80.0f));
+
+    // Dying publishes damage and death; coming back publishes a respawn that drops the history
+    entities[0].currentHealth = 0.0f;
+    RunUpdate(manager, entities, 11000);
+    REQUIRE(manager.GetLastUpdateStats().events == 2);
+    entities[0].currentHealth = 1000.0f;
+    RunUpdate(manager, entities, 12000);
+    REQUIRE(manager.GetLastUpdateStats().events == 1);
+    REQUIRE(manager.GetState(id)->dpsHistory == DpsWindowStore::NO_HISTORY);
+    REQUIRE(manager.GetDps(id, 12000, DpsWindow::ThirtySeconds) == 0.0f);
+    REQUIRE(manager.GetBurstDps(id, 12000) == 0.0f);
+    REQUIRE(manager.GetLastUpdateStats().droppedEvents == 0);
+}
+
+TEST_CASE("Rolling DPS windows are only kept while enabled", "[combat-state]") {
+    CombatStateManager manager;
+    std::vector<RenderableEntity> entities = { MakeEntity(0x1000, 1000.0f) };
+    const void* id = entities[0].address;
+    RunUpdate(manager, entities, 10000);
+
+    // Off by default: no events and no windows, while burst DPS still works
+    entities[0].currentHealth = 800.0f;
+    RunUpdate(manager, entities, 10000);
+    entities[0].currentHealth = 600.0f;
+    RunUpdate(manager, entities, 10500);
+    REQUIRE(manager.GetLastUpdateStats().events == 0);
+    REQUIRE(manager.GetState(id)->dpsHistory == DpsWindowStore::NO_HISTORY);
+    REQUIRE(manager.GetDps(id, 10500, DpsWindow::FiveSeconds) == 0.0f);
+    REQUIRE(manager.GetBurstDps(id, 10500) == Catch::Approx(800.0f));
+
+    manager.SetRollingDpsEnabled(true);
+    entities[0].currentHealth = 400.0f;
+    RunUpdate(manager, entities, 11000);
+    REQUIRE(manager.GetLastUpdateStats().events == 1);
+    REQUIRE(manager.GetDps(id, 11000, DpsWindow::FiveSeconds) == Catch::Approx(40.0f));
+
+    // Disabling drops the windows already kept
+    manager.SetRollingDpsEnabled(false);
+    REQUIRE(manager.GetState(id)->dpsHistory == DpsWindowStore::NO_HISTORY);
+    REQUIRE(manager.GetDps(id, 11000, DpsWindow::FiveSeconds) == 0.0f);
+}
+
+TEST_CASE("Burst DPS stays at the true rate across back-to-back bursts", "[combat-state]") {
+    CombatStateManager manager;
+    std::vector<RenderableEntity> entities = { MakeEntity(0x1000, 1000000.0f) };
+    entities[0].maxHealth = 1000000.0f;
+    const void* id = entities[0].address;
+    RunUpdate(manager, entities, 10000);
+
+    // A steady 1000 DPS: 100 damage every 100ms for 40s. Bursts are cut at MAX_BURST_DURATION_MS,
+    // so the windows always hold damage from earlier bursts that must not be counted.
+    uint64_t lastBurstStart = 0;
+    int bursts = 0;
+    size_t checked = 0;
+    for (uint64_t now = 10100; now <= 50000; now += 100) {
+        entities[0].currentHealth -= 100.0f;
+        RunUpdate(manager, entities, now);
+
+        const EntityCombatState* state = manager.GetState(id);
+        REQUIRE(state != nullptr);
+        if (state->burstStartTime != lastBurstStart) {
+            lastBurstStart = state->burstStartTime;
+            ++bursts;
+        }
+        // The first hit is counted at the burst's start, so short bursts read slightly high
+        if (now - state->burstStartTime >= 2000) {
+            INFO("Burst age " << now - state->burstStartTime << "ms");
+            REQUIRE(manager.GetBurstDps(id, now) == Catch::Approx(1000.0f).epsilon(0.06));
+            ++checked;
+        }
+    }
+    REQUIRE(bursts >= 4);
+    REQUIRE(checked > 100);
+}
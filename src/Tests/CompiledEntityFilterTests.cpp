@@ -0,0 +1,107 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Core/AppState.h"
+#include "../Rendering/Utils/CompiledEntityFilter.h"
+#include "../Rendering/Utils/EntityFilter.h"
+#include "../Rendering/Utils/ESPStyling.h"
+#include <cstdint>
+#include <random>
+
+// CompiledEntityFilter against EntityFilter: for many random settings states, every attitude,
+// rank and gadget type (and values past the end of each enum) must get the verdict the
+// settings branches give. The entity palette must give the colors of the attitude switch.
+
+using namespace kx;
+
+namespace {
+
+/**
+ * @brief Settings with every filter toggle set at random
+ */
+Settings MakeRandomSettings(std::mt19937& rng) {
+    std::bernoulli_distribution coin(0.5);
+    Settings settings;
+
+    for (AttitudeSettings* attitudes : { static_cast<AttitudeSettings*>(&settings.playerESP), static_cast<AttitudeSettings*>(&settings.npcESP) }) {
+        attitudes->showFriendly = coin(rng);
+        attitudes->showHostile = coin(rng);
+        attitudes->showNeutral = coin(rng);
+        attitudes->showIndifferent = coin(rng);
+    }
+    settings.playerESP.enabled = coin(rng);
+    settings.npcESP.enabled = coin(rng);
+
+    NpcEspSettings& npc = settings.npcESP;
+    for (bool* flag : { &npc.showLegendary, &npc.showChampion, &npc.showElite, &npc.showVeteran, &npc.showAmbient, &npc.showNormal }) {
+        *flag = coin(rng);
+    }
+
+    ObjectEspSettings& object = settings.objectESP;
+    for (bool* flag : { &object.enabled, &object.showAttackTargetList, &object.showResourceNodes, &object.showWaypoints,
+                        &object.showVistas, &object.showCraftingStations, &object.showAttackTargets, &object.showPlayerCreated,
+                        &object.showInteractables, &object.showDoors, &object.showPortals, &object.showDestructible,
+                        &object.showPoints, &object.showPlayerSpecific, &object.showProps, &object.showBuildSites,
+                        &object.showBountyBoards, &object.showRifts, &object.showGeneric, &object.showGeneric2,
+                        &object.showUnknown }) {
+        *flag = coin(rng);
+    }
+    return settings;
+}
+
+// Every enum value plus out-of-range ones, as the game memory can hold anything
+constexpr uint32_t ATTITUDE_VALUES[] = { 0, 1, 2, 3, 4, 5, 255, 0xFFFFFFFF };
+constexpr int RANK_VALUES[] = { 0, 1, 2, 3, 4, 5, 6, 7, 100, -1 };
+
+} // anonymous namespace
+
+TEST_CASE("Compiled entity filter matches EntityFilter for every enum value", "[compiled-filter]") {
+    std::mt19937 rng(23);
+    Filtering::CompiledEntityFilter compiled;
+
+    for (int state = 0; state < 500; ++state) {
+        const Settings settings = MakeRandomSettings(rng);
+        compiled.Compile(settings); // Recompiled in place, as every pipeline update does
+
+        REQUIRE(compiled.IsCategoryEnabled(ESPEntityType::Player) == settings.playerESP.enabled);
+        REQUIRE(compiled.IsCategoryEnabled(ESPEntityType::NPC) == settings.npcESP.enabled);
+        REQUIRE(compiled.IsCategoryEnabled(ESPEntityType::Gadget) == settings.objectESP.enabled);
+        REQUIRE(compiled.IsCategoryEnabled(ESPEntityType::AttackTarget) ==
+                (settings.objectESP.enabled && settings.objectESP.showAttackTargetList));
+
+        for (uint32_t attitudeValue : ATTITUDE_VALUES) {
+            const auto attitude = static_cast<Game::Attitude>(attitudeValue);
+            INFO("Attitude " << attitudeValue);
+            REQUIRE(compiled.ShouldRenderPlayer(attitude) == Filtering::EntityFilter::ShouldRenderPlayer(attitude, settings.playerESP));
+
+            for (int rankValue : RANK_VALUES) {
+                const auto rank = static_cast<Game::CharacterRank>(rankValue);
+                INFO("Rank " << rankValue);
+                REQUIRE(compiled.ShouldRenderNpc(attitude, rank) == Filtering::EntityFilter::ShouldRenderNpc(attitude, rank, settings.npcESP));
+            }
+        }
+
+        for (uint32_t typeValue = 0; typeValue < 64; ++typeValue) {
+            const auto type = static_cast<Game::GadgetType>(typeValue);
+            INFO("Gadget type " << typeValue);
+            REQUIRE(compiled.ShouldRenderGadget(type) == Filtering::EntityFilter::ShouldRenderGadget(type, settings.objectESP));
+        }
+        const auto farType = static_cast<Game::GadgetType>(0xFFFFFFFF);
+        REQUIRE(compiled.ShouldRenderGadget(farType) == Filtering::EntityFilter::ShouldRenderGadget(farType, settings.objectESP));
+    }
+}
+
+TEST_CASE("Entity palette gives the attitude colors", "[compiled-filter]") {
+    for (ESPEntityType type : { ESPEntityType::Player, ESPEntityType::NPC }) {
+        REQUIRE(ESPStyling::GetEntityColor(type, Game::Attitude::Hostile) == ESPColors::NPC_HOSTILE);
+        REQUIRE(ESPStyling::GetEntityColor(type, Game::Attitude::Friendly) == ESPColors::NPC_FRIENDLY);
+        REQUIRE(ESPStyling::GetEntityColor(type, Game::Attitude::Neutral) == ESPColors::NPC_NEUTRAL);
+        REQUIRE(ESPStyling::GetEntityColor(type, Game::Attitude::Indifferent) == ESPColors::NPC_INDIFFERENT);
+        REQUIRE(ESPStyling::GetEntityColor(type, static_cast<Game::Attitude>(4)) == ESPColors::NPC_UNKNOWN);
+        REQUIRE(ESPStyling::GetEntityColor(type, static_cast<Game::Attitude>(0xFFFFFFFF)) == ESPColors::NPC_UNKNOWN);
+    }
+    for (ESPEntityType type : { ESPEntityType::Gadget, ESPEntityType::AttackTarget }) {
+        for (uint32_t attitudeValue : ATTITUDE_VALUES) {
+            REQUIRE(ESPStyling::GetEntityColor(type, static_cast<Game::Attitude>(attitudeValue)) == ESPColors::GADGET);
+        }
+    }
+}
@@ -0,0 +1,238 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Rendering/Utils/ESPEntityDetailsBuilder.h"
+#include "../Rendering/Utils/ESPPlayerDetailsBuilder.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+// ESPContextFactory reuses an entity's detail lines while their input hash is unchanged, so
+// the hashes must cover everything the builders read: for random entities and settings,
+// nudged a field at a time, equal hashes must always mean identical lines. Changes the
+// lines can't show (HP within the same integer, hidden fields) must keep the hash.
+//
+// The in-game test runner runs these next to the live pipeline, so names are interned into
+// an arena of the test's own (ScopedEntityNameArena), never the pipeline's.
+
+using namespace kx;
+
+namespace {
+
+using Rng = std::mt19937;
+
+bool Coin(Rng& rng) {
+    return std::uniform_int_distribution<int>(0, 1)(rng) != 0;
+}
+
+int Pick(Rng& rng, int count) {
+    return std::uniform_int_distribution<int>(0, count - 1)(rng);
+}
+
+// Small value domains, so nudged entities often land back on equal inputs
+float RandomHealth(Rng& rng) {
+    static const float VALUES[] = { 0.0f, 0.4f, 1.0f, 1.7f, 250.0f, 250.3f, 1000.0f };
+    return VALUES[Pick(rng, 7)];
+}
+
+glm::vec3 RandomPosition(Rng& rng) {
+    static const float VALUES[] = { -1.0f, 0.0f, 0.04f, 12.5f };
+    return { VALUES[Pick(rng, 4)], VALUES[Pick(rng, 4)], VALUES[Pick(rng, 4)] };
+}
+
+const void* RandomAddress(Rng& rng) {
+    return reinterpret_cast<const void*>(static_cast<uintptr_t>(0x1000 + 0x10 * Pick(rng, 3)));
+}
+
+void Randomize(Rng& rng, RenderableEntity& entity, int field) {
+    switch (field) {
+        case 0: entity.currentHealth = RandomHealth(rng); break;
+        case 1: entity.maxHealth = RandomHealth(rng); break;
+        case 2: entity.position = RandomPosition(rng); break;
+        case 3: entity.address = RandomAddress(rng); break;
+        case 4: entity.agentId = Pick(rng, 3); break;
+        default: entity.currentBarrier = RandomHealth(rng); break; // Not shown in details
+    }
+}
+
+void Randomize(Rng& rng, RenderableNpc& npc, int field) {
+    static const char* NAMES[] = { "", "Bandit", "Bandit Leader" };
+    switch (field) {
+        case 0: npc.name = GetEntityNameArena().Intern(NAMES[Pick(rng, 3)]); break;
+        case 1: npc.level = Pick(rng, 3); break;
+        case 2: npc.attitude = static_cast<Game::Attitude>(Pick(rng, 5)); break;
+        case 3: npc.rank = static_cast<Game::CharacterRank>(Pick(rng, 4)); break;
+        default: Randomize(rng, static_cast<RenderableEntity&>(npc), field - 4); break;
+    }
+}
+
+void Randomize(Rng& rng, RenderableGadget& gadget, int field) {
+    static const Game::GadgetType TYPES[] = { Game::GadgetType::None, Game::GadgetType::ResourceNode, Game::GadgetType::Waypoint };
+    switch (field) {
+        case 0: gadget.type = TYPES[Pick(rng, 3)]; break;
+        case 1: gadget.resourceType = static_cast<Game::ResourceNodeType>(Pick(rng, 3)); break;
+        case 2: gadget.isGatherable = Coin(rng); break;
+        default: Randomize(rng, static_cast<RenderableEntity&>(gadget), field - 3); break;
+    }
+}
+
+void Randomize(Rng& rng, RenderableAttackTarget& attackTarget, int field) {
+    Randomize(rng, static_cast<RenderableEntity&>(attackTarget), field);
+}
+
+void Randomize(Rng& rng, RenderablePlayer& player, int field) {
+    static const float ENERGY[] = { 0.0f, 33.3f, 33.9f, 100.0f };
+    switch (field) {
+        case 0: player.level = Pick(rng, 3) * 40; break;
+        case 1: player.scaledLevel = Pick(rng, 3) * 40; break;
+        case 2: player.profession = static_cast<Game::Profession>(Pick(rng, 3)); break;
+        case 3: player.attitude = static_cast<Game::Attitude>(Pick(rng, 5)); break;
+        case 4: player.race = static_cast<Game::Race>(Pick(rng, 3)); break;
+        case 5: player.currentEnergy = ENERGY[Pick(rng, 4)]; break;
+        case 6: player.maxEnergy = ENERGY[Pick(rng, 4)]; break;
+        case 7:
+        {
+            GearSlotInfo& slot = player.gear[Pick(rng, static_cast<int>(GearLayout::SLOT_COUNT))];
+            slot.itemId = Pick(rng, 2);
+            slot.statId = Pick(rng, 2) * 1000000; // Unknown stat ids format as "stat(N)"
+            slot.rarity = static_cast<Game::ItemRarity>(Pick(rng, 3));
+            break;
+        }
+        default: Randomize(rng, static_cast<RenderableEntity&>(player), field - 8); break;
+    }
+}
+
+void Randomize(Rng& rng, NpcEspSettings& settings) {
+    settings.renderDetails = Coin(rng);
+    settings.showDetailLevel = Coin(rng);
+    settings.showDetailHp = Coin(rng);
+    settings.showDetailAttitude = Coin(rng);
+    settings.showDetailRank = Coin(rng);
+    settings.showDetailPosition = Coin(rng);
+}
+
+void Randomize(Rng& rng, ObjectEspSettings& settings) {
+    settings.renderDetails = Coin(rng);
+    settings.showDetailGadgetType = Coin(rng);
+    settings.showDetailHealth = Coin(rng);
+    settings.showDetailPosition = Coin(rng);
+    settings.showDetailResourceInfo = Coin(rng);
+    settings.showDetailGatherableStatus = Coin(rng);
+}
+
+void Randomize(Rng& rng, PlayerEspSettings& settings) {
+    settings.renderDetails = Coin(rng);
+    settings.showDetailLevel = Coin(rng);
+    settings.showDetailHp = Coin(rng);
+    settings.showDetailAttitude = Coin(rng);
+    settings.showDetailEnergy = Coin(rng);
+    settings.showDetailPosition = Coin(rng);
+    settings.showDetailProfession = Coin(rng);
+    settings.showDetailRace = Coin(rng);
+}
+
+bool SameLines(const std::vector<ColoredDetail>& a, const std::vector<ColoredDetail>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].text != b[i].text || a[i].color != b[i].color) return false;
+    }
+    return true;
+}
+
+struct Outcome {
+    size_t sameHash = 0;
+    size_t staleLines = 0; // Same hash, different lines: the cache would show stale text
+};
+
+/**
+ * @brief Nudge random entities one field at a time and compare hashes against built lines
+ */
+template<typename Entity, typename EspSettings, typename Hash, typename Build>
+Outcome CheckHashCoversLines(uint32_t seed, int fieldCount, Hash hash, Build build) {
+    Rng rng(seed);
+    Outcome outcome;
+    for (int trial = 0; trial < 4000; ++trial) {
+        Entity entity;
+        for (int field = 0; field < fieldCount; ++field) Randomize(rng, entity, field);
+        EspSettings settings;
+        Randomize(rng, settings);
+        const bool showDebugAddresses = Coin(rng);
+
+        Entity nudged = entity;
+        Randomize(rng, nudged, Pick(rng, fieldCount));
+
+        if (hash(&entity, settings, showDebugAddresses) == hash(&nudged, settings, showDebugAddresses)) {
+            ++outcome.sameHash;
+            if (!SameLines(build(&entity, settings, showDebugAddresses), build(&nudged, settings, showDebugAddresses))) {
+                ++outcome.staleLines;
+            }
+        }
+    }
+    return outcome;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Detail input hashes cover every value the builders format", "[detail-cache]") {
+    auto names = std::make_unique<StringArena>();
+    ScopedEntityNameArena useNames(*names);
+
+    SECTION("NPCs") {
+        const Outcome outcome = CheckHashCoversLines<RenderableNpc, NpcEspSettings>(1, 10,
+            ESPEntityDetailsBuilder::HashNpcDetailInputs, ESPEntityDetailsBuilder::BuildNpcDetails);
+        REQUIRE(outcome.sameHash > 100);
+        REQUIRE(outcome.staleLines == 0);
+    }
+    SECTION("Gadgets") {
+        const Outcome outcome = CheckHashCoversLines<RenderableGadget, ObjectEspSettings>(2, 9,
+            ESPEntityDetailsBuilder::HashGadgetDetailInputs, ESPEntityDetailsBuilder::BuildGadgetDetails);
+        REQUIRE(outcome.sameHash > 100);
+        REQUIRE(outcome.staleLines == 0);
+    }
+    SECTION("Attack targets") {
+        const Outcome outcome = CheckHashCoversLines<RenderableAttackTarget, ObjectEspSettings>(3, 6,
+            ESPEntityDetailsBuilder::HashAttackTargetDetailInputs, ESPEntityDetailsBuilder::BuildAttackTargetDetails);
+        REQUIRE(outcome.sameHash > 100);
+        REQUIRE(outcome.staleLines == 0);
+    }
+    SECTION("Players") {
+        const Outcome outcome = CheckHashCoversLines<RenderablePlayer, PlayerEspSettings>(4, 14,
+            ESPPlayerDetailsBuilder::HashPlayerDetailInputs, ESPPlayerDetailsBuilder::BuildPlayerDetails);
+        REQUIRE(outcome.sameHash > 100);
+        REQUIRE(outcome.staleLines == 0);
+    }
+    SECTION("Player gear") {
+        const auto hashGear = [](const RenderablePlayer* player, const PlayerEspSettings&, bool) {
+            return ESPPlayerDetailsBuilder::HashGearDetailInputs(player);
+        };
+        const auto buildGear = [](const RenderablePlayer* player, const PlayerEspSettings&, bool) {
+            return ESPPlayerDetailsBuilder::BuildGearDetails(player);
+        };
+        const Outcome outcome = CheckHashCoversLines<RenderablePlayer, PlayerEspSettings>(5, 14, hashGear, buildGear);
+        REQUIRE(outcome.sameHash > 100);
+        REQUIRE(outcome.staleLines == 0);
+    }
+}
+
+TEST_CASE("Changes the detail lines can't show keep the hash", "[detail-cache]") {
+    auto names = std::make_unique<StringArena>();
+    ScopedEntityNameArena useNames(*names);
+
+    NpcEspSettings settings;
+    settings.renderDetails = true;
+    settings.showDetailPosition = false;
+
+    RenderableNpc npc;
+    npc.name = GetEntityNameArena().Intern("Bandit");
+    npc.level = 12;
+    npc.currentHealth = 800.2f;
+    npc.maxHealth = 1000.0f;
+    const uint64_t hash = ESPEntityDetailsBuilder::HashNpcDetailInputs(&npc, settings, false);
+
+    npc.currentHealth = 800.9f; // Still "HP: 800/1000"
+    npc.position = glm::vec3(5.0f, 0.0f, 5.0f);
+    npc.currentBarrier = 50.0f;
+    REQUIRE(ESPEntityDetailsBuilder::HashNpcDetailInputs(&npc, settings, false) == hash);
+
+    npc.currentHealth = 799.9f;
+    REQUIRE(ESPEntityDetailsBuilder::HashNpcDetailInputs(&npc, settings, false) != hash);
+}
@@ -0,0 +1,134 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Game/ReClassStructs.h"
+#include "../Rendering/Core/EntityExtractor.h"
+#include "../Rendering/Core/EntityRefreshSchedule.h"
+#include "../Rendering/Data/RenderableData.h"
+#include "../Utils/ValidatedPtr.h"
+#include "FakeCharacter.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Warm refresh staggering: characters that appear on the same update are read on first
+// sight, then spread across the interval by address and kept on their own phase, so no
+// single update re-reads every character's warm fields. A character that takes over an
+// address still in the schedule is read as on first sight too.
+
+using namespace kx;
+
+namespace {
+
+constexpr uint64_t INTERVAL = FieldRefresh::WARM_REFRESH_INTERVAL_UPDATES;
+
+const void* CharacterAddress(size_t index) {
+    return reinterpret_cast<const void*>(static_cast<uintptr_t>(0x10000 + 0x10 * index));
+}
+
+/**
+ * @brief Run one update over every character, refreshing the warm tier where due
+ * @return Number of warm refreshes taken this update
+ */
+size_t RunUpdate(EntityRefreshSchedule& schedule, size_t characterCount, std::vector<uint64_t>& lastRefresh, uint64_t update) {
+    schedule.BeginUpdate();
+    size_t refreshed = 0;
+    for (size_t i = 0; i < characterCount; ++i) {
+        CharacterFieldCache& entry = schedule.Touch(CharacterAddress(i));
+        if (schedule.IsWarmDue(entry)) {
+            schedule.MarkWarmRefreshed(entry);
+            lastRefresh[i] = update;
+            ++refreshed;
+        }
+    }
+    schedule.EndUpdate();
+    return refreshed;
+}
+
+/**
+ * @brief One pipeline update extracting a single player through the given schedule
+ */
+RenderablePlayer ExtractOnce(EntityRefreshSchedule& schedule, const FakePlayer& player) {
+    schedule.BeginUpdate();
+    ValidationEpoch::Advance();
+
+    RenderablePlayer renderable;
+    const ReClass::ChCliCharacter character(player.Character());
+    REQUIRE(EntityExtractor::ExtractPlayer(renderable, character, StringHandle{}, nullptr));
+    schedule.EndUpdate();
+    return renderable;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Warm refreshes stay staggered after the first read", "[refresh-schedule]") {
+    constexpr size_t CHARACTERS = INTERVAL * 8;
+    auto schedule = std::make_unique<EntityRefreshSchedule>();
+    std::vector<uint64_t> lastRefresh(CHARACTERS, 0);
+
+    // Everyone is read on first sight
+    REQUIRE(RunUpdate(*schedule, CHARACTERS, lastRefresh, 1) == CHARACTERS);
+
+    // Then each update refreshes only its share, and each character once per interval
+    for (uint64_t update = 2; update < 2 + INTERVAL * 4; ++update) {
+        REQUIRE(RunUpdate(*schedule, CHARACTERS, lastRefresh, update) == CHARACTERS / INTERVAL);
+        for (size_t i = 0; i < CHARACTERS; ++i) {
+            REQUIRE(update - lastRefresh[i] < INTERVAL);
+        }
+    }
+}
+
+TEST_CASE("A reset entry is due on every tier and keeps its slot", "[refresh-schedule]") {
+    auto schedule = std::make_unique<EntityRefreshSchedule>();
+    schedule->BeginUpdate();
+    CharacterFieldCache& entry = schedule->Touch(CharacterAddress(3));
+    schedule->MarkWarmRefreshed(entry);
+    schedule->MarkColdRefreshed(entry);
+    entry.playerFieldsValid = true;
+    entry.gearValid = true;
+    entry.agentId = 7;
+    const uint64_t warmPhase = entry.warmPhase;
+    schedule->EndUpdate();
+
+    schedule->BeginUpdate();
+    CharacterFieldCache& seen = schedule->Touch(CharacterAddress(3));
+    REQUIRE(&seen == &entry);
+    REQUIRE_FALSE(schedule->IsColdDue(seen));
+
+    schedule->ResetForNewCharacter(seen);
+    REQUIRE(schedule->IsColdDue(seen));
+    REQUIRE(schedule->IsWarmDue(seen));
+    REQUIRE_FALSE(seen.playerFieldsValid);
+    REQUIRE_FALSE(seen.gearValid);
+    REQUIRE(seen.agentId == 0);
+    REQUIRE(seen.warmPhase == warmPhase);
+
+    // Still seen this update, so the entry survives EndUpdate
+    schedule->EndUpdate();
+    REQUIRE(schedule->GetStats().trackedEntities == 1);
+}
+
+TEST_CASE("A new character at a tracked address is read as on first sight", "[refresh-schedule]") {
+    // Runs next to the live pipeline in-game: own epoch, own schedule
+    ValidationEpoch::ScopedLocalEpoch localEpoch;
+    auto schedule = std::make_unique<EntityRefreshSchedule>();
+    EntityExtractor::ScopedRefreshSchedule useSchedule(*schedule);
+    FakePlayer player;
+
+    const RenderablePlayer first = ExtractOnce(*schedule, player);
+    REQUIRE(first.agentId == 1);
+    REQUIRE(first.level == 80);
+    REQUIRE(first.attitude == Game::Attitude::Friendly);
+
+    // Same character: the cold tier comes from the cache
+    ExtractOnce(*schedule, player);
+    REQUIRE(schedule->GetStats().coldSkipped == 1);
+
+    // Another character at the same address, seen on the very next update
+    player.ReplaceCharacter(2, 10, Game::Attitude::Hostile);
+    const RenderablePlayer replaced = ExtractOnce(*schedule, player);
+    REQUIRE(replaced.agentId == 2);
+    REQUIRE(replaced.level == 10);
+    REQUIRE(replaced.attitude == Game::Attitude::Hostile);
+    REQUIRE(schedule->GetStats().coldSkipped == 0);
+    REQUIRE(schedule->GetStats().warmSkipped == 0);
+}
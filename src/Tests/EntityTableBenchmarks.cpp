@@ -0,0 +1,223 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Rendering/Data/EntityTable.h"
+#include "../Rendering/Data/RenderableData.h"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <glm.hpp>
+
+// Benchmarks for the filter stage over the struct-of-arrays EntityTable versus the lists of
+// pointers into pooled renderables it replaced. The filter here mirrors ESPFilter's decisions
+// (distances, distance limit, health and attitude/type checks) without the AppState settings,
+// so it builds and runs outside the game:
+//   <test binary> "[benchmark]"
+
+using namespace kx;
+
+namespace {
+
+constexpr float RENDER_DISTANCE_LIMIT = 250.0f;
+
+/**
+ * @brief Pooled renderables for a synthetic scene: 10% players, 40% NPCs, 50% gadgets
+ */
+struct SyntheticScene {
+    std::vector<RenderablePlayer> playerPool;
+    std::vector<RenderableNpc> npcPool;
+    std::vector<RenderableGadget> gadgetPool;
+
+    std::vector<RenderablePlayer*> players;
+    std::vector<RenderableNpc*> npcs;
+    std::vector<RenderableGadget*> gadgets;
+    EntityTable table;
+
+    explicit SyntheticScene(size_t entityCount) {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> coordinate(-400.0f, 400.0f);
+        std::uniform_real_distribution<float> health(0.0f, 1000.0f);
+        std::uniform_int_distribution<int> attitude(0, 3);
+        std::uniform_int_distribution<int> rank(0, 5);
+
+        const size_t playerCount = entityCount / 10;
+        const size_t npcCount = entityCount * 4 / 10;
+        const size_t gadgetCount = entityCount - playerCount - npcCount;
+
+        // Pools never reallocate after this, so the pointers below stay valid
+        playerPool.resize(playerCount);
+        npcPool.resize(npcCount);
+        gadgetPool.resize(gadgetCount);
+
+        auto fillCommon = [&](RenderableEntity& entity, ESPEntityType type) {
+            entity.isValid = true;
+            entity.entityType = type;
+            entity.position = glm::vec3(coordinate(rng), coordinate(rng) * 0.1f, coordinate(rng));
+            entity.maxHealth = 1000.0f;
+            entity.currentHealth = health(rng) < 50.0f ? 0.0f : health(rng);
+            entity.address = &entity;
+        };
+
+        for (auto& player : playerPool) {
+            fillCommon(player, ESPEntityType::Player);
+            player.attitude = static_cast<Game::Attitude>(attitude(rng));
+            players.push_back(&player);
+        }
+        for (auto& npc : npcPool) {
+            fillCommon(npc, ESPEntityType::NPC);
+            npc.attitude = static_cast<Game::Attitude>(attitude(rng));
+            npc.rank = static_cast<Game::CharacterRank>(rank(rng));
+            npcs.push_back(&npc);
+        }
+        for (auto& gadget : gadgetPool) {
+            fillCommon(gadget, ESPEntityType::Gadget);
+            gadget.type = (gadgets.size() % 3 == 0) ? Game::GadgetType::ResourceNode : Game::GadgetType::Waypoint;
+            gadget.isGatherable = health(rng) > 300.0f;
+            gadgets.push_back(&gadget);
+        }
+
+        table.Reserve(entityCount);
+        for (auto* player : players) table.Append(player);
+        for (auto* npc : npcs) table.Append(npc);
+        for (auto* gadget : gadgets) table.Append(gadget);
+    }
+};
+
+bool ShouldRenderAttitude(Game::Attitude attitude) {
+    return attitude != Game::Attitude::Indifferent;
+}
+
+bool ShouldRenderRank(Game::CharacterRank rank) {
+    return rank != Game::CharacterRank::Ambient;
+}
+
+bool ShouldRenderGadget(Game::GadgetType type, bool isGatherable) {
+    return type != Game::GadgetType::ResourceNode || isGatherable;
+}
+
+/**
+ * @brief The pre-table filter: walk each pointer list and read the renderables directly
+ */
+size_t FilterPointerLists(SyntheticScene& scene, const glm::vec3& cameraPos, const glm::vec3& playerPos,
+                          std::vector<const RenderableEntity*>& out) {
+    out.clear();
+    auto passesCommon = [&](RenderableEntity* entity) {
+        if (!entity->isValid) return false;
+        entity->visualDistance = glm::length(entity->position - cameraPos);
+        entity->gameplayDistance = glm::length(entity->position - playerPos);
+        return entity->gameplayDistance <= RENDER_DISTANCE_LIMIT;
+    };
+
+    for (RenderablePlayer* player : scene.players) {
+        if (!passesCommon(player) || player->currentHealth <= 0.0f || !ShouldRenderAttitude(player->attitude)) continue;
+        out.push_back(player);
+    }
+    for (RenderableNpc* npc : scene.npcs) {
+        if (!passesCommon(npc) || npc->currentHealth <= 0.0f || !ShouldRenderAttitude(npc->attitude) || !ShouldRenderRank(npc->rank)) continue;
+        out.push_back(npc);
+    }
+    for (RenderableGadget* gadget : scene.gadgets) {
+        if (!passesCommon(gadget) || !ShouldRenderGadget(gadget->type, gadget->isGatherable)) continue;
+        out.push_back(gadget);
+    }
+    return out.size();
+}
+
+/**
+ * @brief The table filter: distances over the position column, then decisions on hot columns
+ */
+size_t FilterEntityTable(SyntheticScene& scene, const glm::vec3& cameraPos, const glm::vec3& playerPos,
+                         std::vector<const RenderableEntity*>& out) {
+    out.clear();
+    EntityTable& table = scene.table;
+    const size_t rowCount = table.Size();
+
+    for (size_t i = 0; i < rowCount; ++i) {
+        table.visualDistances[i] = glm::length(table.positions[i] - cameraPos);
+        table.gameplayDistances[i] = glm::length(table.positions[i] - playerPos);
+    }
+
+    for (size_t i = 0; i < rowCount; ++i) {
+        if (!(table.flags[i] & EntityRowFlags::VALID) || table.gameplayDistances[i] > RENDER_DISTANCE_LIMIT) continue;
+
+        switch (table.entityTypes[i]) {
+            case ESPEntityType::Player:
+                if (table.currentHealth[i] <= 0.0f || !ShouldRenderAttitude(table.attitudes[i])) continue;
+                break;
+            case ESPEntityType::NPC:
+                if (table.currentHealth[i] <= 0.0f || !ShouldRenderAttitude(table.attitudes[i]) ||
+                    !ShouldRenderRank(static_cast<Game::CharacterRank>(table.subtypes[i]))) continue;
+                break;
+            case ESPEntityType::Gadget:
+                if (!ShouldRenderGadget(static_cast<Game::GadgetType>(table.subtypes[i]),
+                                        (table.flags[i] & EntityRowFlags::GATHERABLE) != 0)) continue;
+                break;
+            default:
+                continue;
+        }
+
+        RenderableEntity* entity = table.entities[i];
+        entity->visualDistance = table.visualDistances[i];
+        entity->gameplayDistance = table.gameplayDistances[i];
+        out.push_back(entity);
+    }
+    return out.size();
+}
+
+} // anonymous namespace
+
+TEST_CASE("EntityTable rows mirror their renderables", "[entity-table]") {
+    SyntheticScene scene(200);
+    const EntityTable& table = scene.table;
+    REQUIRE(table.Size() == 200);
+
+    for (size_t i = 0; i < table.Size(); ++i) {
+        const RenderableEntity* entity = table.entities[i];
+        REQUIRE(table.positions[i] == entity->position);
+        REQUIRE(table.currentHealth[i] == entity->currentHealth);
+        REQUIRE(table.entityTypes[i] == entity->entityType);
+        if (entity->entityType == ESPEntityType::NPC) {
+            const auto* npc = static_cast<const RenderableNpc*>(entity);
+            REQUIRE(table.attitudes[i] == npc->attitude);
+            REQUIRE(static_cast<Game::CharacterRank>(table.subtypes[i]) == npc->rank);
+        }
+    }
+
+    // Rows keep list order: players, then NPCs, then gadgets
+    REQUIRE(table.entities.front() == scene.players.front());
+    REQUIRE(table.entities.back() == scene.gadgets.back());
+}
+
+TEST_CASE("EntityTable filter matches the pointer-list filter", "[entity-table]") {
+    SyntheticScene scene(5000);
+    const glm::vec3 cameraPos(10.0f, 5.0f, -20.0f);
+    const glm::vec3 playerPos(0.0f, 0.0f, 0.0f);
+
+    std::vector<const RenderableEntity*> fromLists;
+    std::vector<const RenderableEntity*> fromTable;
+    FilterPointerLists(scene, cameraPos, playerPos, fromLists);
+    FilterEntityTable(scene, cameraPos, playerPos, fromTable);
+
+    REQUIRE(!fromTable.empty());
+    REQUIRE(fromTable == fromLists);
+}
+
+TEST_CASE("EntityTable filter benchmark", "[.][benchmark]") {
+    const glm::vec3 cameraPos(10.0f, 5.0f, -20.0f);
+    const glm::vec3 playerPos(0.0f, 0.0f, 0.0f);
+
+    for (size_t entityCount : { size_t{ 500 }, size_t{ 5000 }, size_t{ 15000 } }) {
+        SyntheticScene scene(entityCount);
+        std::vector<const RenderableEntity*> output;
+        output.reserve(entityCount);
+        const std::string suffix = " (" + std::to_string(entityCount) + " entities)";
+
+        BENCHMARK("Pointer lists" + suffix) {
+            return FilterPointerLists(scene, cameraPos, playerPos, output);
+        };
+
+        BENCHMARK("Entity table" + suffix) {
+            return FilterEntityTable(scene, cameraPos, playerPos, output);
+        };
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../Game/GameEnums.h"
+#include "../Game/offsets.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace kx {
+
+/**
+ * @brief A player laid out at the offsets ExtractPlayer reads, in ordinary heap memory
+ *
+ * Inventory and the physics chain stay null, so gear and box-shape reads stop early.
+ */
+class FakePlayer {
+public:
+    FakePlayer() {
+        Store(m_character.get(), Offsets::ChCliCharacter::AGENT, m_agent.get());
+        Store(m_character.get(), Offsets::ChCliCharacter::HEALTH, m_health.get());
+        Store(m_character.get(), Offsets::ChCliCharacter::ENERGIES, m_energies.get());
+        Store(m_character.get(), Offsets::ChCliCharacter::SPECIAL_ENERGIES, m_specialEnergies.get());
+        Store(m_character.get(), Offsets::ChCliCharacter::CORE_STATS, m_coreStats.get());
+        Store(m_character.get(), Offsets::ChCliCharacter::ATTITUDE, static_cast<uint32_t>(Game::Attitude::Friendly));
+        Store(m_agent.get(), Offsets::AgChar::CO_CHAR, m_coChar.get());
+        Store(m_agent.get(), Offsets::AgChar::ID, int32_t{ 1 });
+
+        const float position[3] = { 100.0f, 200.0f, 300.0f };
+        memcpy(m_coChar.get() + Offsets::CoChar::VISUAL_POSITION, position, sizeof(position));
+        Store(m_health.get(), Offsets::ChCliHealth::CURRENT, 900.0f);
+        Store(m_health.get(), Offsets::ChCliHealth::MAX, 1000.0f);
+        Store(m_coreStats.get(), Offsets::ChCliCoreStats::LEVEL, 80u);
+    }
+
+    void* Character() const { return m_character.get(); }
+
+    /**
+     * @brief Another character takes over this address: a new agent, level and attitude
+     */
+    void ReplaceCharacter(int32_t agentId, uint32_t level, Game::Attitude attitude) {
+        Store(m_otherAgent.get(), Offsets::AgChar::CO_CHAR, m_coChar.get());
+        Store(m_otherAgent.get(), Offsets::AgChar::ID, agentId);
+        Store(m_character.get(), Offsets::ChCliCharacter::AGENT, m_otherAgent.get());
+        Store(m_character.get(), Offsets::ChCliCharacter::ATTITUDE, static_cast<uint32_t>(attitude));
+        Store(m_coreStats.get(), Offsets::ChCliCoreStats::LEVEL, level);
+    }
+
+private:
+    template<typename T>
+    static void Store(char* base, uintptr_t offset, const T& value) {
+        memcpy(base + offset, &value, sizeof(T));
+    }
+
+    static std::unique_ptr<char[]> Block(size_t size) {
+        auto block = std::make_unique<char[]>(size);
+        memset(block.get(), 0, size);
+        return block;
+    }
+
+    std::unique_ptr<char[]> m_character = Block(0x800);
+    std::unique_ptr<char[]> m_agent = Block(0x200);
+    std::unique_ptr<char[]> m_otherAgent = Block(0x200);
+    std::unique_ptr<char[]> m_coChar = Block(0x200);
+    std::unique_ptr<char[]> m_health = Block(0x100);
+    std::unique_ptr<char[]> m_energies = Block(0x100);
+    std::unique_ptr<char[]> m_specialEnergies = Block(0x100);
+    std::unique_ptr<char[]> m_coreStats = Block(0x400);
+};
+
+} // namespace kx
@@ -0,0 +1,168 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Rendering/Utils/FrustumCulling.h"
+#include "../Rendering/Utils/ScreenProjection.h"
+#include "TestCamera.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <glm.hpp>
+
+// Frustum culling of entity boxes: the SSE kernel must give the scalar verdict for every box,
+// and the cull must be conservative - no entity whose position projects onto the screen is
+// culled, and every culled box has all eight corners behind one plane. The benchmark culls
+// 10k boxes with each kernel next to projecting their positions:
+//   <test binary> "[benchmark]"
+
+using namespace kx;
+using namespace kx::TestCamera;
+
+namespace {
+
+struct Boxes {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> halfExtents;
+};
+
+/**
+ * @brief Entity boxes around the camera, from 0.5m gadgets to 20m physics boxes
+ */
+Boxes MakeBoxes(size_t count, const glm::vec3& around, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> offset(-300.0f, 300.0f);
+    std::uniform_real_distribution<float> height(-30.0f, 30.0f);
+    std::uniform_real_distribution<float> size(0.25f, 10.0f);
+
+    Boxes boxes;
+    boxes.positions.resize(count);
+    boxes.halfExtents.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        boxes.positions[i] = around + glm::vec3(offset(rng), height(rng), offset(rng));
+        const float halfWidth = i % 4 == 0 ? size(rng) : 0.3f;
+        boxes.halfExtents[i] = glm::vec3(halfWidth, i % 4 == 0 ? size(rng) : 0.7f, halfWidth);
+    }
+    return boxes;
+}
+
+bool IsCornerBehind(const glm::vec4& plane, const glm::vec3& corner) {
+    return glm::dot(glm::vec3(plane), corner) + plane.w < 0.0f;
+}
+
+/**
+ * @brief True if all eight corners of the box are behind one plane
+ */
+bool AreAllCornersBehindOnePlane(const FrustumCulling::Planes& planes, const glm::vec3& position, const glm::vec3& h) {
+    for (const glm::vec4& plane : planes) {
+        bool allBehind = true;
+        for (int corner = 0; corner < 8 && allBehind; ++corner) {
+            const glm::vec3 p = position + glm::vec3(corner & 1 ? h.x : -h.x,
+                                                     corner & 2 ? 2.0f * h.y : 0.0f,
+                                                     corner & 4 ? h.z : -h.z);
+            allBehind = IsCornerBehind(plane, p);
+        }
+        if (allBehind) return true;
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+TEST_CASE("SSE frustum cull matches the scalar verdicts", "[frustum-culling]") {
+    if (!FrustumCulling::IsKernelSupported(FrustumCulling::Kernel::Sse)) {
+        WARN("SSE kernel not supported on this CPU, skipped");
+        return;
+    }
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    std::uniform_real_distribution<float> pitch(-0.6f, 0.6f);
+
+    for (int cameraIndex = 0; cameraIndex < 50; ++cameraIndex) {
+        const glm::vec3 position(-400.0f + cameraIndex, 25.0f, 900.0f);
+        const float yaw = angle(rng);
+        const auto planes = FrustumCulling::ExtractPlanes(
+            MakeCamera(position, glm::vec3(std::cos(yaw), pitch(rng), std::sin(yaw)), 1.1f).ViewProjection());
+
+        // 1003 boxes: the SSE kernel also runs its scalar tail
+        Boxes boxes = MakeBoxes(1003, position, static_cast<uint32_t>(cameraIndex));
+        boxes.positions[5] = glm::vec3(std::numeric_limits<float>::quiet_NaN());          // Garbage position
+        boxes.halfExtents[6] = glm::vec3(std::numeric_limits<float>::quiet_NaN(), 1.0f, 1.0f); // Garbage physics size
+
+        std::vector<uint8_t> expected(boxes.positions.size());
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < boxes.positions.size(); ++i) {
+            expected[i] = FrustumCulling::IsBoxVisible(planes, boxes.positions[i], boxes.halfExtents[i]) ? 1 : 0;
+            expectedCount += expected[i];
+        }
+        REQUIRE(expected[5] == 1);
+        REQUIRE(expected[6] == 1);
+        REQUIRE(expectedCount < boxes.positions.size());
+
+        for (FrustumCulling::Kernel kernel : { FrustumCulling::Kernel::Scalar, FrustumCulling::Kernel::Sse }) {
+            std::vector<uint8_t> visible(boxes.positions.size(), 2);
+            const size_t count = FrustumCulling::CullBoxes(kernel, planes, boxes.positions, boxes.halfExtents.data(), visible.data());
+            REQUIRE(count == expectedCount);
+            REQUIRE(visible == expected);
+        }
+    }
+}
+
+TEST_CASE("Frustum cull never drops an entity the visuals stage would draw", "[frustum-culling]") {
+    std::mt19937 rng(12);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    std::uniform_real_distribution<float> pitch(-0.8f, 0.8f);
+
+    size_t culled = 0;
+    size_t onScreen = 0;
+    for (int cameraIndex = 0; cameraIndex < 50; ++cameraIndex) {
+        const glm::vec3 position(30.0f, 5.0f + cameraIndex, -60.0f);
+        const float yaw = angle(rng);
+        const glm::mat4 viewProjection = MakeCamera(position, glm::vec3(std::cos(yaw), pitch(rng), std::sin(yaw)), 1.2f).ViewProjection();
+        const auto planes = FrustumCulling::ExtractPlanes(viewProjection);
+
+        Boxes boxes = MakeBoxes(2000, position, static_cast<uint32_t>(100 + cameraIndex));
+        std::vector<uint8_t> visible(boxes.positions.size());
+        FrustumCulling::CullBoxes(planes, boxes.positions, boxes.halfExtents.data(), visible.data());
+
+        for (size_t i = 0; i < boxes.positions.size(); ++i) {
+            glm::vec2 screen;
+            if (ScreenProjection::ProjectPoint(viewProjection, boxes.positions[i], SCREEN_WIDTH, SCREEN_HEIGHT, screen)) {
+                REQUIRE(visible[i] == 1);
+                ++onScreen;
+            }
+            if (!visible[i]) {
+                REQUIRE(AreAllCornersBehindOnePlane(planes, boxes.positions[i], boxes.halfExtents[i]));
+                ++culled;
+            }
+        }
+    }
+    REQUIRE(onScreen > 0);
+    REQUIRE(culled > 0);
+}
+
+TEST_CASE("Frustum culling benchmark", "[.][benchmark]") {
+    const glm::vec3 position(0.0f, 10.0f, 0.0f);
+    const glm::mat4 viewProjection = MakeCamera(position, glm::vec3(1.0f, -0.05f, 0.2f), 1.1f).ViewProjection();
+    const auto planes = FrustumCulling::ExtractPlanes(viewProjection);
+    const Boxes boxes = MakeBoxes(10000, position, 99);
+    std::vector<uint8_t> visible(boxes.positions.size());
+    std::vector<glm::vec2> screen(boxes.positions.size());
+
+    BENCHMARK("Project every position (10k entities)") {
+        ScreenProjection::ProjectPoints(viewProjection, boxes.positions, SCREEN_WIDTH, SCREEN_HEIGHT, screen.data(), visible.data());
+        return visible[0];
+    };
+
+    BENCHMARK("Cull boxes, scalar kernel (10k entities)") {
+        return FrustumCulling::CullBoxes(FrustumCulling::Kernel::Scalar, planes, boxes.positions, boxes.halfExtents.data(), visible.data());
+    };
+
+    if (FrustumCulling::IsKernelSupported(FrustumCulling::Kernel::Sse)) {
+        BENCHMARK("Cull boxes, SSE kernel (10k entities)") {
+            return FrustumCulling::CullBoxes(FrustumCulling::Kernel::Sse, planes, boxes.positions, boxes.halfExtents.data(), visible.data());
+        };
+    }
+}
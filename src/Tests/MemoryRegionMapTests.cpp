@@ -0,0 +1,330 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Utils/MemoryRegionMap.h"
+#include "../Utils/PointerValidationCache.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+// MemoryRegionMap against a fake, VirtualQuery-like region list. The reference below is
+// the per-address validation SafeAccess::IsMemorySafe used before the region map.
+
+using namespace kx;
+
+namespace {
+
+constexpr uint32_t STATE_FREE = 0x10000;
+constexpr uint32_t STATE_RESERVE = 0x2000;
+constexpr uintptr_t ADDRESS_SPACE_BASE = 0x10000;
+constexpr size_t PAGE_SIZE = 0x1000;
+
+/**
+ * @brief Contiguous region list covering a fake address space, queried like VirtualQuery
+ */
+class FakeRegionSource : public MemoryRegionSource {
+public:
+    explicit FakeRegionSource(uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> pages(1, 64);
+        std::uniform_int_distribution<int> kind(0, 9);
+
+        const uint32_t readableProtections[] = {
+            MemoryProtection::READWRITE, MemoryProtection::READONLY,
+            MemoryProtection::EXECUTE_READ, MemoryProtection::EXECUTE_READWRITE
+        };
+        const uint32_t unreadableProtections[] = {
+            MemoryProtection::NOACCESS, MemoryProtection::READWRITE | MemoryProtection::GUARD, 0x10 /* PAGE_EXECUTE */
+        };
+
+        uintptr_t base = ADDRESS_SPACE_BASE;
+        for (int i = 0; i < 400; ++i) {
+            MemoryRegionInfo region;
+            region.base = base;
+            region.size = pages(rng) * PAGE_SIZE;
+            const int k = kind(rng);
+            if (k < 5) {
+                region.state = MemoryProtection::STATE_COMMIT;
+                region.protect = readableProtections[rng() % 4];
+            } else if (k < 7) {
+                region.state = MemoryProtection::STATE_COMMIT;
+                region.protect = unreadableProtections[rng() % 3];
+            } else {
+                region.state = (k < 9) ? STATE_FREE : STATE_RESERVE;
+            }
+            m_regions.push_back(region);
+            base += region.size;
+        }
+        m_end = base;
+    }
+
+    bool Query(uintptr_t address, MemoryRegionInfo& outRegion) override {
+        const MemoryRegionInfo* region = Find(address);
+        if (!region) return false;
+        outRegion = *region;
+        return true;
+    }
+
+    MemoryRegionInfo* Find(uintptr_t address) {
+        for (auto& region : m_regions) {
+            if (address >= region.base && address < region.base + region.size) {
+                return &region;
+            }
+        }
+        return nullptr;
+    }
+
+    uintptr_t End() const { return m_end; }
+    const std::vector<MemoryRegionInfo>& Regions() const { return m_regions; }
+
+private:
+    std::vector<MemoryRegionInfo> m_regions;
+    uintptr_t m_end = 0;
+};
+
+/**
+ * @brief The previous IsMemorySafe path: per-address cache, one query per unseen address
+ */
+class PerAddressValidator {
+public:
+    explicit PerAddressValidator(MemoryRegionSource& source) : m_source(source) {}
+
+    bool IsReadable(uintptr_t address) {
+        if (m_validAddresses.count(address)) {
+            return true;
+        }
+
+        MemoryRegionInfo mbi;
+        if (!m_source.Query(address, mbi)) return false;
+
+        if (mbi.state != MemoryProtection::STATE_COMMIT) return false;
+        if (!(mbi.protect & (MemoryProtection::READONLY | MemoryProtection::READWRITE |
+                             MemoryProtection::EXECUTE_READ | MemoryProtection::EXECUTE_READWRITE))) return false;
+        if (mbi.protect & (MemoryProtection::GUARD | MemoryProtection::NOACCESS)) return false;
+
+        m_validAddresses.insert(address);
+        return true;
+    }
+
+private:
+    MemoryRegionSource& m_source;
+    std::unordered_set<uintptr_t> m_validAddresses;
+};
+
+std::vector<uintptr_t> MakeProbeAddresses(const FakeRegionSource& source, uint32_t seed) {
+    std::vector<uintptr_t> addresses;
+
+    // Every region boundary and its neighbours
+    for (const auto& region : source.Regions()) {
+        addresses.push_back(region.base - 1);
+        addresses.push_back(region.base);
+        addresses.push_back(region.base + 1);
+        addresses.push_back(region.base + region.size - 1);
+    }
+
+    // Random addresses, including some outside the address space entirely
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<uintptr_t> anywhere(0, source.End() + 0x100000);
+    for (int i = 0; i < 20000; ++i) {
+        addresses.push_back(anywhere(rng));
+    }
+    return addresses;
+}
+
+} // anonymous namespace
+
+TEST_CASE("MemoryRegionMap makes the same decisions as per-address validation", "[memory-region-map]") {
+    for (uint32_t seed : { 1u, 2u, 3u }) {
+        FakeRegionSource source(seed);
+        MemoryRegionMap regionMap(source);
+        PerAddressValidator reference(source);
+
+        const std::vector<uintptr_t> addresses = MakeProbeAddresses(source, seed);
+        size_t accepted = 0;
+        for (uintptr_t address : addresses) {
+            const bool expected = reference.IsReadable(address);
+            REQUIRE(regionMap.IsReadable(address, 0) == expected);
+            accepted += expected;
+        }
+
+        // Both decisions occur, so the comparison means something
+        REQUIRE(accepted > 0);
+        REQUIRE(accepted < addresses.size());
+    }
+}
+
+TEST_CASE("MemoryRegionMap queries each readable region once", "[memory-region-map]") {
+    FakeRegionSource source(7);
+    MemoryRegionMap regionMap(source);
+
+    const auto readable = std::find_if(source.Regions().begin(), source.Regions().end(), [](const MemoryRegionInfo& region) {
+        return MemoryProtection::IsReadable(region.state, region.protect) && region.size >= 4 * PAGE_SIZE;
+    });
+    REQUIRE(readable != source.Regions().end());
+
+    for (uintptr_t address = readable->base; address < readable->base + readable->size; address += 64) {
+        REQUIRE(regionMap.IsReadable(address, 0));
+    }
+    REQUIRE(regionMap.GetQueryCount() == 1);
+    REQUIRE(regionMap.GetRegionCount() == 1);
+}
+
+TEST_CASE("MemoryRegionMap re-queries a region after it is invalidated", "[memory-region-map]") {
+    FakeRegionSource source(11);
+    MemoryRegionMap regionMap(source);
+
+    MemoryRegionInfo* region = nullptr;
+    for (const auto& candidate : source.Regions()) {
+        if (MemoryProtection::IsReadable(candidate.state, candidate.protect)) {
+            region = source.Find(candidate.base);
+            break;
+        }
+    }
+    REQUIRE(region != nullptr);
+
+    const uintptr_t address = region->base + 8;
+    REQUIRE(regionMap.IsReadable(address, 0));
+
+    // The region is decommitted behind the map's back; a faulting read invalidates it
+    region->state = STATE_RESERVE;
+    REQUIRE(regionMap.IsReadable(address, 0)); // Still cached
+    regionMap.Invalidate(address);
+    REQUIRE_FALSE(regionMap.IsReadable(address, 0));
+
+    // Committed again - accepted on the next query, since unreadable regions are never cached
+    region->state = MemoryProtection::STATE_COMMIT;
+    REQUIRE(regionMap.IsReadable(address, 0));
+}
+
+TEST_CASE("MemoryRegionMap expires regions individually and spread over time", "[memory-region-map]") {
+    FakeRegionSource source(13);
+    MemoryRegionMap regionMap(source);
+
+    std::vector<uintptr_t> readableBases;
+    for (const auto& region : source.Regions()) {
+        if (MemoryProtection::IsReadable(region.state, region.protect)) {
+            readableBases.push_back(region.base);
+            REQUIRE(regionMap.IsReadable(region.base, 0));
+        }
+    }
+    const uint64_t initialQueries = regionMap.GetQueryCount();
+    REQUIRE(initialQueries == readableBases.size());
+
+    // Touch every region once per generation; count how many had to be re-queried each time
+    uint64_t busiestGeneration = 0;
+    const uint64_t lastGeneration = MemoryRegionMapConfig::REVALIDATE_AFTER_GENERATIONS + MemoryRegionMapConfig::EXPIRY_SPREAD_GENERATIONS;
+    for (uint64_t generation = 1; generation <= lastGeneration; ++generation) {
+        const uint64_t before = regionMap.GetQueryCount();
+        for (uintptr_t base : readableBases) {
+            REQUIRE(regionMap.IsReadable(base, generation));
+        }
+        const uint64_t requeried = regionMap.GetQueryCount() - before;
+
+        if (generation < MemoryRegionMapConfig::REVALIDATE_AFTER_GENERATIONS) {
+            REQUIRE(requeried == 0);
+        }
+        busiestGeneration = std::max(busiestGeneration, requeried);
+    }
+
+    // Every region was re-verified exactly once, never all in the same generation
+    REQUIRE(regionMap.GetExpiredCount() == readableBases.size());
+    REQUIRE(regionMap.GetQueryCount() - initialQueries == readableBases.size());
+    REQUIRE(busiestGeneration < readableBases.size() / 4);
+}
+
+TEST_CASE("MemoryRegionMap notices a freed region once it expires", "[memory-region-map]") {
+    FakeRegionSource source(17);
+    MemoryRegionMap regionMap(source);
+
+    MemoryRegionInfo* region = nullptr;
+    for (const auto& candidate : source.Regions()) {
+        if (MemoryProtection::IsReadable(candidate.state, candidate.protect)) {
+            region = source.Find(candidate.base);
+            break;
+        }
+    }
+    REQUIRE(region != nullptr);
+
+    uint64_t expiresAt = 0;
+    REQUIRE(regionMap.IsReadable(region->base, 0, &expiresAt));
+    REQUIRE(expiresAt >= MemoryRegionMapConfig::REVALIDATE_AFTER_GENERATIONS);
+    REQUIRE(expiresAt < MemoryRegionMapConfig::REVALIDATE_AFTER_GENERATIONS + MemoryRegionMapConfig::EXPIRY_SPREAD_GENERATIONS);
+
+    region->state = STATE_FREE;
+    REQUIRE(regionMap.IsReadable(region->base, expiresAt - 1));
+    REQUIRE_FALSE(regionMap.IsReadable(region->base, expiresAt));
+}
+
+TEST_CASE("PointerValidationCache makes the same decisions as per-address validation", "[pointer-validation-cache]") {
+    for (uint32_t seed : { 1u, 2u, 3u }) {
+        FakeRegionSource source(seed);
+        PointerValidationCache cache(source);
+        PerAddressValidator reference(source);
+
+        // Probe the whole set twice over a span of generations, so answers come from the page
+        // table, the region map and fresh queries after expiry
+        const std::vector<uintptr_t> addresses = MakeProbeAddresses(source, seed);
+        uint64_t generation = 0;
+        for (int pass = 0; pass < 2; ++pass) {
+            for (size_t i = 0; i < addresses.size(); ++i) {
+                if (i % 256 == 0) ++generation;
+                REQUIRE(cache.IsReadable(addresses[i], generation) == reference.IsReadable(addresses[i]));
+            }
+        }
+
+        const PointerValidationCounters counters = cache.TakeCounters();
+        REQUIRE(counters.lookups == addresses.size() * 2);
+        REQUIRE(counters.pageHits > 0);
+        REQUIRE(counters.regionHits > 0);
+        REQUIRE(cache.TakeCounters().lookups == 0);
+    }
+}
+
+TEST_CASE("PointerValidationCache answers repeated pages without the region map", "[pointer-validation-cache]") {
+    FakeRegionSource source(7);
+    PointerValidationCache cache(source);
+
+    const auto readable = std::find_if(source.Regions().begin(), source.Regions().end(), [](const MemoryRegionInfo& region) {
+        return MemoryProtection::IsReadable(region.state, region.protect) && region.size >= 4 * PAGE_SIZE;
+    });
+    REQUIRE(readable != source.Regions().end());
+
+    // One query for the region, one region-map hit per further page, page hits for the rest
+    const size_t pages = readable->size / PAGE_SIZE;
+    for (uintptr_t address = readable->base; address < readable->base + readable->size; address += 64) {
+        REQUIRE(cache.IsReadable(address, 1));
+    }
+    const PointerValidationCounters counters = cache.TakeCounters();
+    REQUIRE(counters.queries == 1);
+    REQUIRE(counters.regionHits == pages - 1);
+    REQUIRE(counters.pageHits == counters.lookups - pages);
+}
+
+TEST_CASE("PointerValidationCache drops cached pages on invalidate and expiry", "[pointer-validation-cache]") {
+    FakeRegionSource source(11);
+    PointerValidationCache cache(source);
+
+    MemoryRegionInfo* region = nullptr;
+    for (const auto& candidate : source.Regions()) {
+        if (MemoryProtection::IsReadable(candidate.state, candidate.protect)) {
+            region = source.Find(candidate.base);
+            break;
+        }
+    }
+    REQUIRE(region != nullptr);
+    const uintptr_t address = region->base + 8;
+
+    REQUIRE(cache.IsReadable(address, 0));
+    region->state = STATE_RESERVE;
+    REQUIRE(cache.IsReadable(address, 0)); // Page still cached
+    cache.Invalidate(address);
+    REQUIRE_FALSE(cache.IsReadable(address, 0));
+
+    // Without an invalidate, the page goes stale with its region
+    region->state = MemoryProtection::STATE_COMMIT;
+    REQUIRE(cache.IsReadable(address, 0));
+    region->state = STATE_RESERVE;
+    const uint64_t lastExpiry = MemoryRegionMapConfig::REVALIDATE_AFTER_GENERATIONS + MemoryRegionMapConfig::EXPIRY_SPREAD_GENERATIONS;
+    REQUIRE_FALSE(cache.IsReadable(address, lastExpiry));
+}
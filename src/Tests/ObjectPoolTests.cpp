@@ -0,0 +1,117 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Utils/ObjectPool.h"
+#include "../Utils/ShardedObjectPool.h"
+#include <cstdint>
+#include <vector>
+
+using namespace kx;
+
+namespace {
+    struct PooledItem {
+        uint64_t value = 0;
+        uint8_t payload[120] = {};
+    };
+
+    constexpr ObjectPoolConfig TEST_CONFIG{ 16, 100, 4 };
+}
+
+TEST_CASE("ObjectPool grows by segments without moving objects", "[object-pool]") {
+    ObjectPool<PooledItem> pool(TEST_CONFIG);
+    REQUIRE(pool.GetSegmentCount() == 1);
+
+    std::vector<PooledItem*> items;
+    for (uint64_t i = 0; i < 60; ++i) {
+        PooledItem* item = pool.Get();
+        REQUIRE(item != nullptr);
+        item->value = i;
+        items.push_back(item);
+    }
+
+    REQUIRE(pool.GetSegmentCount() == 4);
+    REQUIRE(pool.Size() == 64);
+
+    // Every pointer still refers to the object it was handed out as
+    for (uint64_t i = 0; i < items.size(); ++i) {
+        REQUIRE(items[i]->value == i);
+    }
+}
+
+TEST_CASE("ObjectPool stops at maxSize and counts refused requests", "[object-pool]") {
+    ObjectPool<PooledItem> pool(TEST_CONFIG);
+
+    for (size_t i = 0; i < TEST_CONFIG.maxSize; ++i) {
+        REQUIRE(pool.Get() != nullptr);
+    }
+    REQUIRE(pool.Get() == nullptr);
+    REQUIRE(pool.Get() == nullptr);
+
+    ObjectPoolStats stats = pool.GetStats();
+    REQUIRE(stats.used == TEST_CONFIG.maxSize);
+    REQUIRE(stats.exhaustedRequests == 2);
+    REQUIRE(stats.highWater == TEST_CONFIG.maxSize);
+
+    pool.Reset();
+    stats = pool.GetStats();
+    REQUIRE(stats.used == 0);
+    REQUIRE(stats.exhaustedRequests == 0);
+    REQUIRE(stats.highWater == TEST_CONFIG.maxSize);
+}
+
+TEST_CASE("ObjectPool reuses segments and releases idle ones", "[object-pool]") {
+    ObjectPool<PooledItem> pool(TEST_CONFIG);
+
+    // A burst needs 4 segments
+    for (int i = 0; i < 64; ++i) {
+        pool.Get();
+    }
+    pool.Reset();
+
+    // Quiet updates keep using the first segment; the burst segments stay for the idle period
+    for (uint32_t update = 1; update < TEST_CONFIG.releaseIdleAfterResets; ++update) {
+        PooledItem* first = pool.Get();
+        REQUIRE(first != nullptr);
+        pool.Reset();
+        REQUIRE(pool.GetSegmentCount() == 4);
+    }
+
+    pool.Get();
+    pool.Reset();
+    REQUIRE(pool.GetSegmentCount() == 1);
+    REQUIRE(pool.GetStats().highWater == 64);
+
+    // Growing again after a release works as before
+    for (int i = 0; i < 40; ++i) {
+        REQUIRE(pool.Get() != nullptr);
+    }
+    REQUIRE(pool.GetSegmentCount() == 3);
+}
+
+TEST_CASE("ObjectPool never releases segments when the idle period is zero", "[object-pool]") {
+    ObjectPool<PooledItem> pool(ObjectPoolConfig{ 16, 100, 0 });
+    for (int i = 0; i < 64; ++i) {
+        pool.Get();
+    }
+    for (int update = 0; update < 100; ++update) {
+        pool.Reset();
+    }
+    REQUIRE(pool.GetSegmentCount() == 4);
+}
+
+TEST_CASE("ShardedObjectPool aggregates shard counters", "[object-pool]") {
+    ShardedObjectPool<PooledItem, 4> pool(TEST_CONFIG);
+
+    for (size_t shard = 0; shard < pool.GetShardCount(); ++shard) {
+        for (size_t i = 0; i <= shard * 10; ++i) {
+            pool.Shard(shard).Get();
+        }
+    }
+
+    const ObjectPoolStats stats = pool.GetStats();
+    REQUIRE(stats.used == 1 + 11 + 21 + 31);
+    REQUIRE(stats.capacity == (1 + 1 + 2 + 2) * TEST_CONFIG.segmentSize);
+
+    pool.Reset();
+    REQUIRE(pool.Used() == 0);
+    REQUIRE(pool.GetStats().highWater == 64);
+}
@@ -0,0 +1,164 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Rendering/Utils/ScreenProjection.h"
+#include "TestCamera.h"
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <glm.hpp>
+
+// Batched world-to-screen kernels against the scalar ProjectPoint(): every supported kernel
+// must agree bit for bit on visibility and screen coordinates, for points in view, behind
+// the camera, on the frustum edges, in array tails that don't fill a vector, and NaN.
+// The benchmark projects 10k points per-point through proj * view (the old WorldToScreen),
+// per-point through the cached view-projection, and with each batched kernel:
+//   <test binary> "[benchmark]"
+
+using namespace kx;
+using namespace kx::TestCamera;
+
+namespace {
+
+/**
+ * @brief Points around the camera: most in front, some behind, some far past the sides
+ */
+std::vector<glm::vec3> MakePoints(size_t count, const glm::vec3& around, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> offset(-300.0f, 300.0f);
+    std::uniform_real_distribution<float> height(-30.0f, 30.0f);
+
+    std::vector<glm::vec3> points(count);
+    for (auto& point : points) point = around + glm::vec3(offset(rng), height(rng), offset(rng));
+    return points;
+}
+
+bool SameBits(float a, float b) {
+    return std::bit_cast<uint32_t>(a) == std::bit_cast<uint32_t>(b);
+}
+
+const ScreenProjection::Kernel ALL_KERNELS[] = {
+    ScreenProjection::Kernel::Scalar, ScreenProjection::Kernel::Sse, ScreenProjection::Kernel::Avx2
+};
+
+const char* KernelName(ScreenProjection::Kernel kernel) {
+    switch (kernel) {
+        case ScreenProjection::Kernel::Scalar: return "scalar";
+        case ScreenProjection::Kernel::Sse:    return "SSE";
+        case ScreenProjection::Kernel::Avx2:   return "AVX2";
+    }
+    return "?";
+}
+
+} // anonymous namespace
+
+TEST_CASE("Batched projection kernels match the scalar path bit for bit", "[screen-projection]") {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    std::uniform_real_distribution<float> pitch(-0.6f, 0.6f);
+
+    for (int cameraIndex = 0; cameraIndex < 50; ++cameraIndex) {
+        const glm::vec3 position(1200.0f + cameraIndex, 40.0f, -800.0f - cameraIndex);
+        const float yaw = angle(rng);
+        const glm::vec3 front(std::cos(yaw), pitch(rng), std::sin(yaw));
+        const CameraMatrices camera = MakeCamera(position, front, 1.1f);
+        const glm::mat4 viewProjection = camera.projection * camera.view;
+
+        // 1003 points: every kernel also runs its scalar tail
+        std::vector<glm::vec3> points = MakePoints(1003, position, static_cast<uint32_t>(cameraIndex));
+        points[5] = position;                                        // At the camera
+        points[6] = position + glm::normalize(front) * 0.1f;         // On the near plane
+        points[7] = glm::vec3(std::numeric_limits<float>::quiet_NaN()); // Garbage read
+
+        std::vector<uint8_t> expectedVisible(points.size());
+        std::vector<glm::vec2> expectedScreen(points.size(), glm::vec2(0.0f));
+        size_t visibleCount = 0;
+        for (size_t i = 0; i < points.size(); ++i) {
+            expectedVisible[i] = ScreenProjection::ProjectPoint(viewProjection, points[i], SCREEN_WIDTH, SCREEN_HEIGHT, expectedScreen[i]);
+            visibleCount += expectedVisible[i];
+        }
+        REQUIRE(visibleCount > 0);
+        REQUIRE(visibleCount < points.size());
+
+        for (ScreenProjection::Kernel kernel : ALL_KERNELS) {
+            if (!ScreenProjection::IsKernelSupported(kernel)) {
+                WARN(KernelName(kernel) << " kernel not supported on this CPU, skipped");
+                continue;
+            }
+            INFO("Kernel: " << KernelName(kernel));
+
+            std::vector<glm::vec2> screen(points.size(), glm::vec2(-1.0f));
+            std::vector<uint8_t> visible(points.size(), 2);
+            ScreenProjection::ProjectPoints(kernel, viewProjection, points, SCREEN_WIDTH, SCREEN_HEIGHT, screen.data(), visible.data());
+
+            size_t mismatches = 0;
+            for (size_t i = 0; i < points.size(); ++i) {
+                const bool same = visible[i] == expectedVisible[i] &&
+                                  SameBits(screen[i].x, expectedScreen[i].x) && SameBits(screen[i].y, expectedScreen[i].y);
+                mismatches += same ? 0 : 1;
+            }
+            REQUIRE(mismatches == 0);
+        }
+    }
+}
+
+TEST_CASE("Projection through the cached view-projection stays on the old pixel", "[screen-projection]") {
+    const glm::vec3 position(100.0f, 20.0f, 100.0f);
+    const CameraMatrices camera = MakeCamera(position, glm::vec3(0.3f, -0.1f, 1.0f), 1.2f);
+    const glm::mat4 viewProjection = camera.projection * camera.view;
+
+    size_t compared = 0;
+    for (const glm::vec3& point : MakePoints(2000, position, 17)) {
+        glm::vec2 screen;
+        if (!ScreenProjection::ProjectPoint(viewProjection, point, SCREEN_WIDTH, SCREEN_HEIGHT, screen)) continue;
+
+        // The previous WorldToScreen: proj * view * point, then the viewport transform
+        glm::vec4 clip = camera.projection * camera.view * glm::vec4(point, 1.0f);
+        clip /= clip.w;
+        const glm::vec2 old(SCREEN_WIDTH * (clip.x + 1.0f) * 0.5f, SCREEN_HEIGHT * (1.0f - (clip.y + 1.0f) * 0.5f));
+        REQUIRE(std::abs(screen.x - old.x) < 0.01f);
+        REQUIRE(std::abs(screen.y - old.y) < 0.01f);
+        ++compared;
+    }
+    REQUIRE(compared > 100);
+}
+
+TEST_CASE("Screen projection benchmark", "[.][benchmark]") {
+    const glm::vec3 position(0.0f, 10.0f, 0.0f);
+    const CameraMatrices camera = MakeCamera(position, glm::vec3(1.0f, -0.05f, 0.2f), 1.1f);
+    const glm::mat4 viewProjection = camera.projection * camera.view;
+    const std::vector<glm::vec3> points = MakePoints(10000, position, 99);
+    std::vector<glm::vec2> screen(points.size());
+    std::vector<uint8_t> visible(points.size());
+
+    BENCHMARK("Per point, proj * view * point (10k points)") {
+        size_t count = 0;
+        for (size_t i = 0; i < points.size(); ++i) {
+            glm::vec4 clip = camera.projection * camera.view * glm::vec4(points[i], 1.0f);
+            if (clip.w <= 0.0f) continue;
+            clip /= clip.w;
+            screen[i] = glm::vec2(SCREEN_WIDTH * (clip.x + 1.0f) * 0.5f, SCREEN_HEIGHT * (1.0f - (clip.y + 1.0f) * 0.5f));
+            count += clip.x >= -1.0f && clip.x <= 1.0f && clip.y >= -1.0f && clip.y <= 1.0f && clip.z >= 0.0f && clip.z <= 1.0f;
+        }
+        return count;
+    };
+
+    BENCHMARK("Per point, cached view-projection (10k points)") {
+        size_t count = 0;
+        for (size_t i = 0; i < points.size(); ++i) {
+            count += ScreenProjection::ProjectPoint(viewProjection, points[i], SCREEN_WIDTH, SCREEN_HEIGHT, screen[i]);
+        }
+        return count;
+    };
+
+    for (ScreenProjection::Kernel kernel : ALL_KERNELS) {
+        if (!ScreenProjection::IsKernelSupported(kernel)) continue;
+        BENCHMARK(std::string("Batched ") + KernelName(kernel) + " kernel (10k points)") {
+            ScreenProjection::ProjectPoints(kernel, viewProjection, points, SCREEN_WIDTH, SCREEN_HEIGHT, screen.data(), visible.data());
+            return visible[0];
+        };
+    }
+}
@@ -0,0 +1,68 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Core/SettingsSnapshot.h"
+#include <memory>
+
+// SettingsObserver gating: derived tables are rebuilt exactly once per published version,
+// from the snapshot they were handed, and never for a snapshot they have already seen.
+
+using namespace kx;
+
+namespace {
+
+SettingsSnapshot MakeSnapshot(uint64_t version, float globalOpacity) {
+    auto settings = std::make_shared<Settings>();
+    settings->appearance.globalOpacity = globalOpacity;
+    return SettingsSnapshot{ std::move(settings), version };
+}
+
+} // anonymous namespace
+
+TEST_CASE("SettingsObserver rebuilds once per version", "[settings]") {
+    SettingsObserver observer;
+    int rebuilds = 0;
+    float builtOpacity = 0.0f;
+    auto rebuild = [&](const Settings& settings) {
+        ++rebuilds;
+        builtOpacity = settings.appearance.globalOpacity;
+    };
+
+    const SettingsSnapshot first = MakeSnapshot(1, 0.5f);
+    REQUIRE(observer.Refresh(first, rebuild));
+    REQUIRE(rebuilds == 1);
+    REQUIRE(builtOpacity == 0.5f);
+    REQUIRE(observer.GetVersion() == 1);
+
+    // Same version on the next updates: the table is current
+    REQUIRE_FALSE(observer.Refresh(first, rebuild));
+    REQUIRE_FALSE(observer.Refresh(first, rebuild));
+    REQUIRE(rebuilds == 1);
+
+    const SettingsSnapshot second = MakeSnapshot(2, 0.25f);
+    REQUIRE(observer.Refresh(second, rebuild));
+    REQUIRE(rebuilds == 2);
+    REQUIRE(builtOpacity == 0.25f);
+    REQUIRE(observer.GetVersion() == 2);
+}
+
+TEST_CASE("SettingsObserver rebuilds after Invalidate", "[settings]") {
+    SettingsObserver observer;
+    int rebuilds = 0;
+    auto rebuild = [&](const Settings&) { ++rebuilds; };
+
+    const SettingsSnapshot snapshot = MakeSnapshot(7, 1.0f);
+    observer.Refresh(snapshot, rebuild);
+    observer.Invalidate();
+    REQUIRE(observer.GetVersion() == 0);
+    REQUIRE(observer.Refresh(snapshot, rebuild));
+    REQUIRE(rebuilds == 2);
+}
+
+TEST_CASE("Snapshots stay immutable while the live settings change", "[settings]") {
+    Settings live;
+    live.appearance.globalOpacity = 0.8f;
+    const SettingsSnapshot snapshot{ std::make_shared<const Settings>(live), 1 };
+
+    live.appearance.globalOpacity = 0.1f;
+    REQUIRE(snapshot.Get().appearance.globalOpacity == 0.8f);
+}
@@ -0,0 +1,122 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Utils/StringArena.h"
+#include <string>
+#include <vector>
+
+using namespace kx;
+
+// --- HELPERS ---
+
+namespace {
+    std::vector<std::string> MakeNames(size_t count, const char* prefix) {
+        std::vector<std::string> names;
+        names.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            names.push_back(std::string(prefix) + " " + std::to_string(i));
+        }
+        return names;
+    }
+}
+
+// --- TESTS ---
+
+TEST_CASE("StringArena interns and resolves strings", "[string-arena]") {
+    StringArena arena;
+
+    StringHandle a = arena.Intern("Rytlock Brimstone");
+    StringHandle b = arena.Intern("Logan Thackeray");
+    StringHandle c = arena.Intern("Rytlock Brimstone");
+
+    REQUIRE(a.IsValid());
+    REQUIRE(b.IsValid());
+    REQUIRE(a == c); // Identical strings share one entry
+    REQUIRE_FALSE(a == b);
+    REQUIRE(arena.Resolve(a) == "Rytlock Brimstone");
+    REQUIRE(arena.Resolve(b) == "Logan Thackeray");
+
+    REQUIRE_FALSE(arena.Intern("").IsValid());
+    REQUIRE(arena.Resolve(StringHandle{}).empty());
+}
+
+TEST_CASE("StringArena truncates long strings on a UTF-8 boundary", "[string-arena]") {
+    StringArena arena;
+
+    // 'é' is two bytes, so byte MAX_STRING_LENGTH falls in the middle of a character
+    std::string longText = "a";
+    while (longText.size() < StringArenaConfig::MAX_STRING_LENGTH + 8) {
+        longText += "\xC3\xA9";
+    }
+
+    std::string_view resolved = arena.Resolve(arena.Intern(longText));
+    REQUIRE(resolved.size() <= StringArenaConfig::MAX_STRING_LENGTH);
+    REQUIRE((static_cast<unsigned char>(resolved.back()) & 0xC0) != 0xC0); // Doesn't end on a lead byte
+}
+
+TEST_CASE("StringArena reclaims untouched strings by generation", "[string-arena]") {
+    StringArena arena;
+
+    StringHandle kept = arena.Intern("kept");
+    StringHandle dropped = arena.Intern("dropped");
+
+    // Finish the update both were interned in, then let RECLAIM_AFTER_UPDATES updates pass
+    arena.EndUpdate();
+    for (uint64_t i = 0; i < StringArenaConfig::RECLAIM_AFTER_UPDATES - 1; ++i) {
+        arena.Touch(kept);
+        arena.EndUpdate();
+    }
+    REQUIRE(arena.Resolve(dropped) == "dropped"); // Still within the grace period
+
+    arena.Touch(kept);
+    arena.EndUpdate();
+
+    REQUIRE(arena.Resolve(kept) == "kept");
+    REQUIRE(arena.Resolve(dropped).empty()); // Stale handle after reclaim
+
+    // The reclaimed slot is reused under a new generation
+    StringHandle reused = arena.Intern("reused");
+    REQUIRE(reused.index == dropped.index);
+    REQUIRE(reused.generation != dropped.generation);
+    REQUIRE(arena.Resolve(dropped).empty());
+    REQUIRE(arena.Resolve(reused) == "reused");
+}
+
+TEST_CASE("StringArena performs zero allocations per update in steady state", "[string-arena]") {
+    constexpr size_t VISIBLE_NAMES = 150;          // Roughly a busy WvW fight
+    constexpr size_t CHURN_PER_UPDATE = 5;         // Players joining/leaving each update
+    constexpr int WARMUP_UPDATES = 100;
+    constexpr int MEASURED_UPDATES = 200;
+
+    StringArena arena;
+    const std::vector<std::string> population = MakeNames(1000, "Player");
+
+    // Stands in for the pool objects that carry handles through the pipeline
+    std::vector<StringHandle> pooled(VISIBLE_NAMES);
+
+    size_t firstVisible = 0;
+    auto runUpdate = [&]() {
+        for (size_t i = 0; i < VISIBLE_NAMES; ++i) {
+            const std::string& name = population[(firstVisible + i) % population.size()];
+            pooled[i] = arena.Intern(name);
+        }
+        arena.EndUpdate();
+        firstVisible += CHURN_PER_UPDATE;
+    };
+
+    for (int i = 0; i < WARMUP_UPDATES; ++i) {
+        runUpdate();
+    }
+
+    // The arena counts its own heap allocations (storage blocks and lookup table)
+    const uint64_t warmedUp = arena.GetStats().heapAllocations;
+    REQUIRE(warmedUp > 0);
+
+    for (int i = 0; i < MEASURED_UPDATES; ++i) {
+        runUpdate();
+    }
+
+    REQUIRE(arena.GetStats().heapAllocations == warmedUp);
+    for (size_t i = 0; i < VISIBLE_NAMES; ++i) {
+        REQUIRE(arena.Resolve(pooled[i]) == population[(firstVisible - CHURN_PER_UPDATE + i) % population.size()]);
+    }
+}
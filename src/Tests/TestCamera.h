@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cmath>
+#include <glm.hpp>
+
+namespace kx {
+
+/**
+ * @brief Camera matrices for the projection and culling tests
+ */
+namespace TestCamera {
+
+constexpr float SCREEN_WIDTH = 2560.0f;
+constexpr float SCREEN_HEIGHT = 1440.0f;
+
+struct CameraMatrices {
+    glm::mat4 view;
+    glm::mat4 projection;
+
+    glm::mat4 ViewProjection() const { return projection * view; }
+};
+
+/**
+ * @brief View and projection built the way Camera::Update builds them from MumbleLink
+ */
+inline CameraMatrices MakeCamera(const glm::vec3& position, const glm::vec3& front, float fovRadians) {
+    const glm::vec3 zaxis = glm::normalize(front);
+    const glm::vec3 xaxis = glm::normalize(glm::cross(glm::vec3(0.0f, 1.0f, 0.0f), zaxis));
+    const glm::vec3 yaxis = glm::cross(zaxis, xaxis);
+
+    CameraMatrices camera;
+    camera.view = glm::mat4(1.0f);
+    camera.view[0][0] = xaxis.x; camera.view[0][1] = yaxis.x; camera.view[0][2] = zaxis.x;
+    camera.view[1][0] = xaxis.y; camera.view[1][1] = yaxis.y; camera.view[1][2] = zaxis.y;
+    camera.view[2][0] = xaxis.z; camera.view[2][1] = yaxis.z; camera.view[2][2] = zaxis.z;
+    camera.view[3][0] = -glm::dot(xaxis, position);
+    camera.view[3][1] = -glm::dot(yaxis, position);
+    camera.view[3][2] = -glm::dot(zaxis, position);
+
+    const float zNear = 0.1f;
+    const float zFar = 30000.0f;
+    const float aspect = SCREEN_WIDTH / SCREEN_HEIGHT;
+    camera.projection = glm::mat4(0.0f);
+    camera.projection[0][0] = 1.0f / (aspect * std::tan(fovRadians / 2.0f));
+    camera.projection[1][1] = 1.0f / std::tan(fovRadians / 2.0f);
+    camera.projection[2][2] = zFar / (zFar - zNear);
+    camera.projection[2][3] = 1.0f;
+    camera.projection[3][2] = -(zFar * zNear) / (zFar - zNear);
+    return camera;
+}
+
+} // namespace TestCamera
+} // namespace kx
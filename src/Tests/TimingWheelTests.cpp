@@ -0,0 +1,94 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Utils/TimingWheel.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+// TimingWheel against a plain list of deadlines: every Advance() must fire exactly the
+// timers a per-update "deadline <= now" scan would, across both wheel levels, the horizon
+// and long gaps between updates.
+
+using namespace kx;
+
+namespace {
+
+using FiredTimer = std::pair<uint64_t, uint32_t>; // deadline, id
+
+std::vector<FiredTimer> AdvanceAndCollect(TimingWheel& wheel, uint64_t now) {
+    std::vector<FiredTimer> fired;
+    wheel.Advance(now, [&](uint32_t id, uint64_t deadline) { fired.emplace_back(deadline, id); });
+    std::sort(fired.begin(), fired.end());
+    return fired;
+}
+
+std::vector<FiredTimer> TakeExpired(std::vector<FiredTimer>& pending, uint64_t now) {
+    std::vector<FiredTimer> expired;
+    auto split = std::partition(pending.begin(), pending.end(), [now](const FiredTimer& timer) {
+        return timer.first > now;
+    });
+    expired.assign(split, pending.end());
+    pending.erase(split, pending.end());
+    std::sort(expired.begin(), expired.end());
+    return expired;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Timing wheel fires timers on the update that reaches their deadline", "[timing-wheel]") {
+    TimingWheel wheel;
+    AdvanceAndCollect(wheel, 1000);
+
+    wheel.Schedule(1, 1005);  // Same tick as now
+    wheel.Schedule(2, 1200);  // Inner wheel
+    wheel.Schedule(3, 9000);  // Outer wheel (max burst duration)
+    wheel.Schedule(4, 900);   // Already due
+    REQUIRE(wheel.GetPendingCount() == 4);
+
+    REQUIRE(AdvanceAndCollect(wheel, 1004) == std::vector<FiredTimer>{ { 900, 4 } });
+    REQUIRE(AdvanceAndCollect(wheel, 1005) == std::vector<FiredTimer>{ { 1005, 1 } });
+    REQUIRE(AdvanceAndCollect(wheel, 1199).empty());
+    REQUIRE(AdvanceAndCollect(wheel, 1200) == std::vector<FiredTimer>{ { 1200, 2 } });
+    REQUIRE(AdvanceAndCollect(wheel, 8999).empty());
+    REQUIRE(AdvanceAndCollect(wheel, 9016) == std::vector<FiredTimer>{ { 9000, 3 } });
+    REQUIRE(wheel.GetPendingCount() == 0);
+}
+
+TEST_CASE("Timing wheel matches a deadline scan under random schedules", "[timing-wheel]") {
+    std::mt19937_64 rng(11);
+    std::uniform_int_distribution<uint64_t> step(0, 40);          // Update intervals, ms
+    std::uniform_int_distribution<uint64_t> delay(0, 10000);      // Covers every CombatEffects timeout
+    std::uniform_int_distribution<uint64_t> farDelay(0, 200000);  // Past the ~41s horizon
+    std::uniform_int_distribution<int> roll(0, 999);
+
+    TimingWheel wheel;
+    std::vector<FiredTimer> pending;
+    uint64_t now = 123456;
+    uint32_t nextId = 0;
+
+    for (int update = 0; update < 50000; ++update) {
+        const int r = roll(rng);
+        if (r == 0) {
+            now += 60000 + step(rng); // Pipeline stalled for a minute
+        } else {
+            now += step(rng);
+        }
+
+        REQUIRE(AdvanceAndCollect(wheel, now) == TakeExpired(pending, now));
+
+        const int schedules = r % 4;
+        for (int i = 0; i < schedules; ++i) {
+            const uint64_t deadline = now + (r < 20 ? farDelay(rng) : delay(rng));
+            wheel.Schedule(nextId, deadline);
+            pending.emplace_back(deadline, nextId);
+            ++nextId;
+        }
+        REQUIRE(wheel.GetPendingCount() == pending.size());
+    }
+
+    now += 300000;
+    REQUIRE(AdvanceAndCollect(wheel, now) == TakeExpired(pending, now));
+    REQUIRE(pending.empty());
+}
@@ -0,0 +1,106 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Rendering/Combat/TrailHistoryStore.h"
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+// TrailHistoryStore against the std::deque the trail history used to be kept in: after any
+// sequence of pushes and capacity changes, every trail must hold the same points in the
+// same order.
+
+using namespace kx;
+
+namespace {
+
+PositionHistoryPoint MakePoint(uint64_t timestamp) {
+    PositionHistoryPoint point;
+    point.position = glm::vec3(static_cast<float>(timestamp), 0.0f, 0.0f);
+    point.timestamp = timestamp;
+    return point;
+}
+
+std::vector<uint64_t> Timestamps(const TrailHistoryStore& store, uint32_t trail) {
+    std::vector<PositionHistoryPoint> points;
+    REQUIRE(store.AppendTo(trail, points) == store.Size(trail));
+    std::vector<uint64_t> timestamps;
+    for (const auto& point : points) timestamps.push_back(point.timestamp);
+    return timestamps;
+}
+
+std::vector<uint64_t> Timestamps(const std::deque<PositionHistoryPoint>& reference) {
+    std::vector<uint64_t> timestamps;
+    for (const auto& point : reference) timestamps.push_back(point.timestamp);
+    return timestamps;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Trail history rings keep the newest points in order", "[trail-history]") {
+    TrailHistoryStore store;
+    store.SetCapacity(4);
+    const uint32_t trail = store.Acquire();
+    REQUIRE(store.Newest(trail) == nullptr);
+
+    for (uint64_t t = 1; t <= 6; ++t) store.Push(trail, MakePoint(t));
+
+    REQUIRE(Timestamps(store, trail) == std::vector<uint64_t>{ 3, 4, 5, 6 });
+    REQUIRE(store.Newest(trail)->timestamp == 6);
+}
+
+TEST_CASE("Trail history matches a bounded deque under random pushes and resizes", "[trail-history]") {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> trailPick(0, 7);
+    std::uniform_int_distribution<int> action(0, 99);
+    std::uniform_int_distribution<uint32_t> capacityPick(15, 60); // The settings slider's range
+
+    TrailHistoryStore store;
+    uint32_t capacity = 30;
+    store.SetCapacity(capacity);
+
+    std::vector<uint32_t> trails;
+    std::vector<std::deque<PositionHistoryPoint>> references(8);
+    for (int i = 0; i < 8; ++i) trails.push_back(store.Acquire());
+
+    for (uint64_t step = 1; step <= 20000; ++step) {
+        const int roll = action(rng);
+        const int index = trailPick(rng);
+        if (roll == 0) {
+            capacity = capacityPick(rng);
+            store.SetCapacity(capacity);
+            for (auto& reference : references) {
+                while (reference.size() > capacity) reference.pop_front();
+            }
+        } else if (roll == 1) {
+            // Entity left; a new one takes the freed trail
+            store.Release(trails[index]);
+            trails[index] = store.Acquire();
+            references[index].clear();
+        } else {
+            store.Push(trails[index], MakePoint(step));
+            references[index].push_back(MakePoint(step));
+            if (references[index].size() > capacity) references[index].pop_front();
+        }
+    }
+
+    for (size_t i = 0; i < trails.size(); ++i) {
+        REQUIRE(Timestamps(store, trails[i]) == Timestamps(references[i]));
+    }
+    REQUIRE(store.GetActiveCount() == trails.size());
+}
+
+TEST_CASE("Released trails are reused before the pool grows", "[trail-history]") {
+    TrailHistoryStore store;
+    store.SetCapacity(30);
+    const uint32_t first = store.Acquire();
+    const uint32_t second = store.Acquire();
+    store.Push(first, MakePoint(1));
+
+    store.Release(first);
+    const uint32_t reused = store.Acquire();
+    REQUIRE(reused == first);
+    REQUIRE(reused != second);
+    REQUIRE(store.Size(reused) == 0);
+    REQUIRE(store.GetActiveCount() == 2);
+}
@@ -0,0 +1,92 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Utils/VTableVerdictCache.h"
+#include <cstdint>
+
+// VTableVerdictCache on made-up module bounds: the verdicts must match the plain bounds
+// check IsVTablePointerValid used before, and kinds are only enforced once trusted.
+
+using namespace kx;
+
+namespace {
+
+constexpr uintptr_t MODULE_BASE = 0x140000000;
+constexpr size_t MODULE_SIZE = 0x2000000;
+
+constexpr uintptr_t CHARACTER_VTABLE = MODULE_BASE + 0x1A00000;
+constexpr uintptr_t GADGET_VTABLE = MODULE_BASE + 0x1A01230;
+
+using Verdict = VTableVerdictCache::Verdict;
+
+Verdict Check(VTableVerdictCache& cache, uintptr_t vtable, VTableKind expected) {
+    return cache.Check(vtable, expected, MODULE_BASE, MODULE_SIZE);
+}
+
+void Sight(VTableVerdictCache& cache, uintptr_t vtable, VTableKind kind, uint16_t times) {
+    for (uint16_t i = 0; i < times; ++i) {
+        REQUIRE(Check(cache, vtable, kind) == Verdict::Valid);
+    }
+}
+
+} // anonymous namespace
+
+TEST_CASE("VTable verdicts match the module bounds check", "[vtable-verdict]") {
+    VTableVerdictCache cache;
+    // The in-module ones land in distinct slots, so none evicts another
+    const uintptr_t vtables[] = {
+        0, 0x1000, MODULE_BASE - 8, MODULE_BASE, MODULE_BASE + 8,
+        MODULE_BASE + MODULE_SIZE - 0x18, MODULE_BASE + MODULE_SIZE, UINTPTR_MAX
+    };
+
+    // Twice, so the second round is answered from the cache
+    for (int round = 0; round < 2; ++round) {
+        for (uintptr_t vtable : vtables) {
+            const bool inModule = vtable >= MODULE_BASE && vtable < MODULE_BASE + MODULE_SIZE;
+            REQUIRE((Check(cache, vtable, VTableKind::Any) == Verdict::Valid) == inModule);
+        }
+    }
+
+    const VTableVerdictCounters counters = cache.TakeCounters();
+    REQUIRE(counters.lookups == 16);
+    REQUIRE(counters.hits == 3);     // Only the in-module vtables are remembered
+    REQUIRE(counters.mistyped == 0);
+    REQUIRE(cache.GetPendingLookups() == 0);
+}
+
+TEST_CASE("A trusted vtable kind rejects entries from another list", "[vtable-verdict]") {
+    VTableVerdictCache cache;
+    Sight(cache, CHARACTER_VTABLE, VTableKind::Character, VTableVerdictConfig::TRUSTED_SIGHTINGS);
+    Sight(cache, GADGET_VTABLE, VTableKind::Gadget, VTableVerdictConfig::TRUSTED_SIGHTINGS);
+
+    // A gadget left in a character slot, and the other way round
+    REQUIRE(Check(cache, GADGET_VTABLE, VTableKind::Character) == Verdict::WrongKind);
+    REQUIRE(Check(cache, CHARACTER_VTABLE, VTableKind::Gadget) == Verdict::WrongKind);
+
+    // Untyped checks and the owning list are unaffected
+    REQUIRE(Check(cache, GADGET_VTABLE, VTableKind::Any) == Verdict::Valid);
+    REQUIRE(Check(cache, CHARACTER_VTABLE, VTableKind::Character) == Verdict::Valid);
+    REQUIRE(cache.TakeCounters().mistyped == 2);
+}
+
+TEST_CASE("A vtable claimed by two kinds before being trusted is never rejected", "[vtable-verdict]") {
+    VTableVerdictCache cache;
+    Sight(cache, CHARACTER_VTABLE, VTableKind::Character, VTableVerdictConfig::TRUSTED_SIGHTINGS - 1);
+    Sight(cache, CHARACTER_VTABLE, VTableKind::Gadget, 1);
+
+    Sight(cache, CHARACTER_VTABLE, VTableKind::Character, VTableVerdictConfig::TRUSTED_SIGHTINGS);
+    Sight(cache, CHARACTER_VTABLE, VTableKind::Gadget, VTableVerdictConfig::TRUSTED_SIGHTINGS);
+    REQUIRE(cache.TakeCounters().mistyped == 0);
+}
+
+TEST_CASE("Moving the module drops every verdict", "[vtable-verdict]") {
+    VTableVerdictCache cache;
+    Sight(cache, CHARACTER_VTABLE, VTableKind::Character, VTableVerdictConfig::TRUSTED_SIGHTINGS);
+    REQUIRE(Check(cache, CHARACTER_VTABLE, VTableKind::Gadget) == Verdict::WrongKind);
+
+    // Same vtable address, but now outside the (rescanned) module
+    const uintptr_t movedBase = MODULE_BASE + MODULE_SIZE;
+    REQUIRE(cache.Check(CHARACTER_VTABLE, VTableKind::Character, movedBase, MODULE_SIZE) == Verdict::OutsideModule);
+
+    // Back in bounds, the learned kind is gone too
+    REQUIRE(Check(cache, CHARACTER_VTABLE, VTableKind::Gadget) == Verdict::Valid);
+}
@@ -0,0 +1,112 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Game/ReClassStructs.h"
+#include "../Game/offsets.h"
+#include "../Rendering/Core/EntityExtractor.h"
+#include "../Rendering/Core/EntityRefreshSchedule.h"
+#include "../Rendering/Data/RenderableData.h"
+#include "../Utils/MemorySafety.h"
+#include "../Utils/ValidatedPtr.h"
+#include "FakeCharacter.h"
+#include <cstdint>
+#include <memory>
+
+// Validation proofs: a SafeForeignClass validated this update copies without another
+// IsMemorySafe call. The counts come from the calling thread's pointer-validation counters,
+// which see every IsMemorySafe call.
+//
+// These tests also run from the in-game test runner while the pipeline is live, so each one
+// works on a ScopedLocalEpoch and extracts through its own refresh schedule; the shared epoch
+// and the pipeline's schedule are never touched.
+
+using namespace kx;
+
+namespace {
+
+/**
+ * @brief IsMemorySafe calls the calling thread has made since the last call
+ */
+uint64_t TakeValidationCalls() {
+    return SafeAccess::GetValidationCache().TakeCounters().lookups;
+}
+
+/**
+ * @brief IsMemorySafe calls one ExtractPlayer makes on a character it has never seen
+ */
+uint64_t CountExtractPlayerValidations(const FakePlayer& player) {
+    // A fresh schedule, so every refresh tier is due
+    auto schedule = std::make_unique<EntityRefreshSchedule>();
+    EntityExtractor::ScopedRefreshSchedule useSchedule(*schedule);
+    schedule->BeginUpdate();
+
+    ReClass::ChCliCharacter character(player.Character());
+    RenderablePlayer renderable;
+
+    TakeValidationCalls();
+    const bool extracted = EntityExtractor::ExtractPlayer(renderable, character, StringHandle{}, nullptr);
+    const uint64_t calls = TakeValidationCalls();
+
+    REQUIRE(extracted);
+    REQUIRE(renderable.maxHealth == 1000.0f);
+    return calls;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Validation proofs expire with the epoch", "[validated-ptr]") {
+    ValidationEpoch::ScopedLocalEpoch localEpoch;
+    int object = 0;
+    ValidationEpoch::Advance();
+    const ValidatedPtr proof = ValidatedPtr::Vouch(&object);
+    REQUIRE(proof.IsCurrent());
+
+    ValidationEpoch::Advance();
+    REQUIRE_FALSE(proof.IsCurrent());
+
+    ValidationEpoch::Suspend();
+    REQUIRE_FALSE(ValidatedPtr::Vouch(&object).IsCurrent());
+
+    // Wrapping around never lands on NONE
+    ValidationEpoch::Storage().store(UINT32_MAX);
+    ValidationEpoch::Advance();
+    REQUIRE(ValidationEpoch::Current() != ValidationEpoch::NONE);
+    REQUIRE(ValidatedPtr::Vouch(&object).IsCurrent());
+}
+
+TEST_CASE("Copies of a wrapper validated this update skip IsMemorySafe", "[validated-ptr]") {
+    ValidationEpoch::ScopedLocalEpoch localEpoch;
+    ValidationEpoch::Advance();
+    FakePlayer player;
+
+    TakeValidationCalls();
+    ReClass::ChCliCharacter character(player.Character());
+    REQUIRE(TakeValidationCalls() == 1);
+
+    ReClass::ChCliCharacter copy = character;
+    SafeForeignClass borrowed(character.Borrow());
+    REQUIRE(copy);
+    REQUIRE(borrowed);
+    REQUIRE(TakeValidationCalls() == 0);
+
+    // A new update re-validates the next copy once, then trusts it again
+    ValidationEpoch::Advance();
+    ReClass::ChCliCharacter nextUpdate = character;
+    REQUIRE(nextUpdate);
+    REQUIRE(TakeValidationCalls() == 1);
+}
+
+TEST_CASE("ExtractPlayer makes fewer IsMemorySafe calls with validation proofs", "[validated-ptr]") {
+    ValidationEpoch::ScopedLocalEpoch localEpoch;
+    FakePlayer player;
+
+    // Before: every copy and every truth test re-validates
+    ValidationEpoch::Suspend();
+    const uint64_t before = CountExtractPlayerValidations(player);
+
+    // After: one validation per pointer per update, and same-page fields read under the proof
+    ValidationEpoch::Advance();
+    const uint64_t after = CountExtractPlayerValidations(player);
+
+    WARN("IsMemorySafe calls per ExtractPlayer: " << before << " before, " << after << " after");
+    REQUIRE(after < before);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace kx {
+
+/**
+ * @brief Per-range output lists that are concatenated in range order after a parallel pass
+ *
+ * Workers append to the list of the range they are processing; MergeInto() then yields
+ * exactly the order a serial walk over the backing array would have produced, no matter
+ * which worker handled which range.
+ */
+template<typename T>
+class ChunkedResults {
+private:
+    std::vector<std::vector<T*>> m_chunks;
+    size_t m_activeChunks = 0;
+
+public:
+    /**
+     * @brief Prepare for a pass over chunkCount ranges (keeps previously allocated capacity)
+     */
+    void Begin(size_t chunkCount) {
+        if (m_chunks.size() < chunkCount) {
+            m_chunks.resize(chunkCount);
+        }
+        for (size_t i = 0; i < chunkCount; ++i) {
+            m_chunks[i].clear();
+        }
+        m_activeChunks = chunkCount;
+    }
+
+    std::vector<T*>& Chunk(size_t chunkIndex) {
+        return m_chunks[chunkIndex];
+    }
+
+    /**
+     * @brief Append every chunk to out, in chunk order
+     */
+    void MergeInto(std::vector<T*>& out) const {
+        size_t total = out.size();
+        for (size_t i = 0; i < m_activeChunks; ++i) {
+            total += m_chunks[i].size();
+        }
+        out.reserve(total);
+        for (size_t i = 0; i < m_activeChunks; ++i) {
+            out.insert(out.end(), m_chunks[i].begin(), m_chunks[i].end());
+        }
+    }
+};
+
+} // namespace kx
@@ -4,6 +4,7 @@
 #include <format>
 #include <memory>
 #include <atomic>
+#include <cstring>
 #include <Windows.h>
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -319,7 +320,13 @@ inline bool SafeRead(void* basePtr, uintptr_t offset, T& result) noexcept {
         return false;
     }
     
-    return SafeReadImpl(address, result);
+    if (!SafeReadImpl(address, result)) {
+        // The cached region was stale (or the read ran past its end) - query it again next time
+        SafeAccess::InvalidateRegion(address);
+        SafeAccess::InvalidateRegion(address + sizeof(T) - 1);
+        return false;
+    }
+    return true;
 }
 
 /**
@@ -350,7 +357,68 @@ inline bool SafeRead(const void* basePtr, uintptr_t offset, T& result) noexcept
         return false;
     }
     
-    return SafeReadImpl(address, result);
+    if (!SafeReadImpl(address, result)) {
+        // The cached region was stale (or the read ran past its end) - query it again next time
+        SafeAccess::InvalidateRegion(address);
+        SafeAccess::InvalidateRegion(address + sizeof(T) - 1);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Copy a span of foreign memory under a single exception guard
+ * @param address Start of the span
+ * @param dest Buffer of at least size bytes
+ * @param size Number of bytes to copy
+ * @return true if the whole span was copied, false otherwise
+ */
+inline bool SafeReadBytesImpl(uintptr_t address, void* dest, size_t size) noexcept {
+    __try {
+        memcpy(dest, reinterpret_cast<const void*>(address), size);
+        return true;
+    }
+    __except (EXCEPTION_EXECUTE_HANDLER) {
+        return false;
+    }
+}
+
+/**
+ * @brief Safe read of a whole span of memory with one validation
+ *
+ * Checks the first and last byte instead of every field, so a struct that straddles two
+ * regions is still caught; a fault mid-copy invalidates both ends like SafeRead does.
+ *
+ * @param basePtr Base pointer to read from
+ * @param offset Offset from base pointer
+ * @param dest Buffer of at least size bytes
+ * @param size Number of bytes to copy
+ * @return true if the span was copied, false otherwise
+ */
+inline bool SafeReadBytes(const void* basePtr, uintptr_t offset, void* dest, size_t size) noexcept {
+    if (!basePtr || size == 0) {
+        return false;
+    }
+
+    const uintptr_t address = reinterpret_cast<uintptr_t>(basePtr) + offset;
+    const uintptr_t last = address + size - 1;
+    if (last < address ||
+        address < SafeAccess::MIN_VALID_MEMORY_ADDRESS ||
+        last > SafeAccess::MAX_VALID_MEMORY_ADDRESS) {
+        return false;
+    }
+
+    if (!SafeAccess::IsMemorySafe(reinterpret_cast<void*>(address), size) ||
+        !SafeAccess::IsMemorySafe(reinterpret_cast<void*>(last), 1)) {
+        return false;
+    }
+
+    if (!SafeReadBytesImpl(address, dest, size)) {
+        SafeAccess::InvalidateRegion(address);
+        SafeAccess::InvalidateRegion(last);
+        return false;
+    }
+    return true;
 }
 
 /**
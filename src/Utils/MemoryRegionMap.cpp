@@ -0,0 +1,96 @@
+#include "MemoryRegionMap.h"
+
+#include <algorithm>
+
+namespace kx {
+
+MemoryRegionMap::MemoryRegionMap(MemoryRegionSource& source)
+    : m_source(source) {
+    m_regions.reserve(MemoryRegionMapConfig::MAX_REGIONS);
+}
+
+namespace {
+    // Spreads expiry of regions cached in the same generation over EXPIRY_SPREAD_GENERATIONS
+    uint64_t ExpiryOffset(uintptr_t base) {
+        uint64_t hash = static_cast<uint64_t>(base) * 0x9E3779B97F4A7C15ull;
+        return (hash >> 32) % MemoryRegionMapConfig::EXPIRY_SPREAD_GENERATIONS;
+    }
+}
+
+bool MemoryRegionMap::IsReadable(uintptr_t address, uint64_t generation, uint64_t* outExpiresAt) {
+    const ptrdiff_t index = FindRegion(address);
+    if (index >= 0) {
+        const Region& region = m_regions[index];
+        if (generation < region.expiresAt) {
+            if (outExpiresAt) *outExpiresAt = region.expiresAt;
+            return true;
+        }
+
+        // Too old to trust - drop it and ask the source again
+        m_regions.erase(m_regions.begin() + index);
+        ++m_expiredCount;
+    }
+
+    MemoryRegionInfo info;
+    ++m_queryCount;
+    if (!m_source.Query(address, info)) {
+        return false;
+    }
+
+    if (!MemoryProtection::IsReadable(info.state, info.protect)) {
+        return false;
+    }
+
+    // Guard against a source reporting a region that doesn't contain the address
+    const uintptr_t end = info.base + info.size;
+    if (address < info.base || address >= end) {
+        if (outExpiresAt) *outExpiresAt = generation; // Nothing cached - valid for this lookup only
+        return true;
+    }
+
+    const uint64_t expiresAt = generation + MemoryRegionMapConfig::REVALIDATE_AFTER_GENERATIONS + ExpiryOffset(info.base);
+    InsertRegion(info.base, end, expiresAt);
+    if (outExpiresAt) *outExpiresAt = expiresAt;
+    return true;
+}
+
+void MemoryRegionMap::Invalidate(uintptr_t address) {
+    const ptrdiff_t index = FindRegion(address);
+    if (index >= 0) {
+        m_regions.erase(m_regions.begin() + index);
+    }
+}
+
+void MemoryRegionMap::Clear() {
+    m_regions.clear();
+}
+
+ptrdiff_t MemoryRegionMap::FindRegion(uintptr_t address) const {
+    // First region starting after the address; its predecessor is the only candidate
+    auto it = std::upper_bound(m_regions.begin(), m_regions.end(), address,
+        [](uintptr_t value, const Region& region) { return value < region.base; });
+    if (it == m_regions.begin()) {
+        return -1;
+    }
+    --it;
+    return address < it->end ? (it - m_regions.begin()) : -1;
+}
+
+void MemoryRegionMap::InsertRegion(uintptr_t base, uintptr_t end, uint64_t expiresAt) {
+    if (m_regions.size() >= MemoryRegionMapConfig::MAX_REGIONS) {
+        m_regions.clear();
+    }
+
+    // Drop cached regions the new one overlaps - the layout changed since they were queried
+    auto first = std::lower_bound(m_regions.begin(), m_regions.end(), base,
+        [](const Region& region, uintptr_t value) { return region.end <= value; });
+    auto last = first;
+    while (last != m_regions.end() && last->base < end) {
+        ++last;
+    }
+    first = m_regions.erase(first, last);
+
+    m_regions.insert(first, Region{ base, end, expiresAt });
+}
+
+} // namespace kx
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace kx {
+
+/**
+ * @brief Win32 region state and protection values used to classify regions
+ *
+ * Mirrors MEM_COMMIT / PAGE_* so the classification can be built and tested off Windows.
+ */
+namespace MemoryProtection {
+    constexpr uint32_t STATE_COMMIT = 0x1000;
+
+    constexpr uint32_t NOACCESS = 0x01;
+    constexpr uint32_t READONLY = 0x02;
+    constexpr uint32_t READWRITE = 0x04;
+    constexpr uint32_t EXECUTE_READ = 0x20;
+    constexpr uint32_t EXECUTE_READWRITE = 0x40;
+    constexpr uint32_t GUARD = 0x100;
+
+    /**
+     * @brief Whether a region with this state and protection can be read
+     */
+    constexpr bool IsReadable(uint32_t state, uint32_t protect) {
+        if (state != STATE_COMMIT) return false;
+        if (!(protect & (READONLY | READWRITE | EXECUTE_READ | EXECUTE_READWRITE))) return false;
+        if (protect & (GUARD | NOACCESS)) return false;
+        return true;
+    }
+}
+
+/**
+ * @brief One region as reported by the OS (VirtualQuery's MEMORY_BASIC_INFORMATION)
+ */
+struct MemoryRegionInfo {
+    uintptr_t base = 0;
+    size_t size = 0;
+    uint32_t state = 0;
+    uint32_t protect = 0;
+};
+
+/**
+ * @brief Where a MemoryRegionMap gets region information from
+ *
+ * The game uses VirtualQuery (see SafeAccess in MemorySafety.h); tests back it with a
+ * fixed region list.
+ */
+class MemoryRegionSource {
+public:
+    virtual ~MemoryRegionSource() = default;
+
+    /**
+     * @brief Describe the region containing an address
+     * @return False if the address could not be queried at all
+     */
+    virtual bool Query(uintptr_t address, MemoryRegionInfo& outRegion) = 0;
+};
+
+/**
+ * @brief MemoryRegionMap configuration
+ */
+namespace MemoryRegionMapConfig {
+    constexpr size_t MAX_REGIONS = 4096; // The map is cleared if it ever holds more readable regions than this
+
+    // Regions are re-queried once they are this many generations old, plus a per-region
+    // offset in [0, EXPIRY_SPREAD_GENERATIONS) so regions cached together expire apart
+    constexpr uint64_t REVALIDATE_AFTER_GENERATIONS = 50;
+    constexpr uint64_t EXPIRY_SPREAD_GENERATIONS = 20;
+}
+
+/**
+ * @brief Sorted interval map of readable memory regions
+ *
+ * Built lazily: an address that falls inside a known readable region is accepted with a
+ * binary search; anything else is asked of the region source once, and if its region is
+ * readable the whole region is remembered. Unreadable regions are not remembered, since
+ * reserved memory can be committed at any time and must then be accepted right away.
+ *
+ * Each region carries the generation it was verified in and expires on its own a while
+ * later (see MemoryRegionMapConfig), so memory that was freed is noticed without ever
+ * re-querying everything at once. Regions that turn out to be stale earlier (a guarded
+ * read faulted) are dropped with Invalidate().
+ *
+ * Not thread-safe; SafeAccess keeps one map per thread.
+ */
+class MemoryRegionMap {
+public:
+    explicit MemoryRegionMap(MemoryRegionSource& source);
+
+    /**
+     * @brief Whether the address lies in committed, readable memory
+     * @param generation Current generation; regions verified too long before it are re-queried
+     * @param outExpiresAt If not null and the address is readable, receives the generation
+     *                     its region must be re-verified in
+     */
+    bool IsReadable(uintptr_t address, uint64_t generation, uint64_t* outExpiresAt = nullptr);
+
+    /**
+     * @brief Forget the region containing an address (e.g. after a read from it faulted)
+     */
+    void Invalidate(uintptr_t address);
+
+    /**
+     * @brief Forget every region
+     */
+    void Clear();
+
+    size_t GetRegionCount() const { return m_regions.size(); }
+
+    /**
+     * @brief Number of region source queries made so far
+     */
+    uint64_t GetQueryCount() const { return m_queryCount; }
+
+    /**
+     * @brief Number of regions that expired and were re-queried so far
+     */
+    uint64_t GetExpiredCount() const { return m_expiredCount; }
+
+private:
+    struct Region {
+        uintptr_t base;
+        uintptr_t end;      // One past the last byte
+        uint64_t expiresAt; // Generation the region must be re-queried in
+    };
+
+    // Index of the region containing address, or -1
+    ptrdiff_t FindRegion(uintptr_t address) const;
+    void InsertRegion(uintptr_t base, uintptr_t end, uint64_t expiresAt);
+
+    MemoryRegionSource& m_source;
+    std::vector<Region> m_regions; // Sorted by base, non-overlapping
+    uint64_t m_queryCount = 0;
+    uint64_t m_expiredCount = 0;
+};
+
+} // namespace kx
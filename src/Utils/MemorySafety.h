@@ -1,9 +1,10 @@
 #pragma once
 
 #include <Windows.h>
-#include <ankerl/unordered_dense.h>
-#include <chrono>
 #include "../Game/AddressManager.h"
+#include "MemoryRegionMap.h"
+#include "PointerValidationCache.h"
+#include "ValidatedPtr.h"
 
 namespace kx {
 namespace SafeAccess {
@@ -20,34 +21,81 @@ namespace SafeAccess {
     constexpr uint32_t MAX_REASONABLE_GADGET_COUNT = 15000;      // Observed ~9216, allow for resource-rich areas
     constexpr uint32_t MAX_REASONABLE_ATTACK_TARGET_COUNT = 5000; // Reasonable limit for attack targets
 
-    // --- Pointer Cache for Performance ---
-    // Thread-safe cache accessors using function-local statics
-    inline ankerl::unordered_dense::segmented_set<uintptr_t>& GetValidPointersCache() {
-        thread_local ankerl::unordered_dense::segmented_set<uintptr_t> cache;
+    // --- Readable Region Cache ---
+
+    /**
+     * @brief Region source backed by VirtualQuery
+     */
+    class VirtualQueryRegionSource : public MemoryRegionSource {
+    public:
+        bool Query(uintptr_t address, MemoryRegionInfo& outRegion) override {
+            MEMORY_BASIC_INFORMATION mbi = {};
+            if (VirtualQuery(reinterpret_cast<LPCVOID>(address), &mbi, sizeof(mbi)) == 0) {
+                return false;
+            }
+            outRegion.base = reinterpret_cast<uintptr_t>(mbi.BaseAddress);
+            outRegion.size = mbi.RegionSize;
+            outRegion.state = mbi.State;
+            outRegion.protect = mbi.Protect;
+            return true;
+        }
+    };
+
+    // Thread-local so extraction workers never contend on it
+    inline PointerValidationCache& GetValidationCache() {
+        thread_local VirtualQueryRegionSource source;
+        thread_local PointerValidationCache cache(source);
         return cache;
     }
-    
-    inline std::chrono::steady_clock::time_point& GetLastCacheClear() {
-        thread_local std::chrono::steady_clock::time_point lastClear = std::chrono::steady_clock::now();
-        return lastClear;
+
+    inline VTableVerdictCache& GetVTableVerdictCache() {
+        thread_local VTableVerdictCache cache;
+        return cache;
+    }
+
+    inline PointerValidationTelemetry& GetValidationTelemetry() {
+        static PointerValidationTelemetry telemetry;
+        return telemetry;
     }
-    
-    static constexpr auto CACHE_CLEAR_INTERVAL = std::chrono::seconds(5);
 
     /**
-     * @brief Clears the pointer cache periodically to handle entity despawning
+     * @brief Current cache generation; cached regions expire a few seconds' worth of these after being verified
      */
-    inline void ClearCacheIfNeeded() {
-        auto now = std::chrono::steady_clock::now();
-        auto& lastClear = GetLastCacheClear();
-        if (now - lastClear >= CACHE_CLEAR_INTERVAL) {
-            GetValidPointersCache().clear();
-            lastClear = now;
-        }
+    inline uint64_t GetValidationGeneration() {
+        return GetTickCount64() / PointerValidationConfig::GENERATION_MS;
+    }
+
+    /**
+     * @brief Forget the cached region containing an address whose read just faulted
+     */
+    inline void InvalidateRegion(uintptr_t address) {
+        GetValidationCache().Invalidate(address);
+        ValidationEpoch::Advance(); // Wrappers validated earlier may point into the same region
+    }
+
+    /**
+     * @brief Publish this thread's counters and close the update's validation stats
+     *
+     * Called by the pipeline thread once per extraction; also ends the ValidationEpoch, so
+     * SafeForeignClass proofs never outlive the update. Worker threads publish on their own
+     * every COUNTER_FLUSH_INTERVAL lookups, so their last few lookups count towards the next update.
+     */
+    inline void EndValidationUpdate() {
+        GetValidationTelemetry().Add(GetValidationCache().TakeCounters());
+        GetValidationTelemetry().Add(GetVTableVerdictCache().TakeCounters());
+        GetValidationTelemetry().EndUpdate();
+
+        // Wrappers validated during this update must validate again in the next one
+        ValidationEpoch::Advance();
     }
 
     /**
      * @brief Validates if a memory address is safe to read (with caching for performance)
+     *
+     * Recently validated pages are accepted from a small direct-mapped table, other addresses
+     * inside a known readable region with a binary search; VirtualQuery only runs for addresses
+     * outside every known region, or whose region has reached its (staggered) expiry.
+     *
      * @param ptr Pointer to validate
      * @param size Size of data to read (default: pointer size)
      * @return true if memory is safe to read, false otherwise
@@ -62,39 +110,25 @@ namespace SafeAccess {
             return false;
         }
 
-        // Clear cache periodically to handle entity despawning
-        ClearCacheIfNeeded();
-        
-        // Check cache first - avoid expensive VirtualQuery if already validated
-        // Use find() for single lookup instead of count() + insert()
-        auto& validPointers = GetValidPointersCache();
-        auto it = validPointers.find(address);
-        if (it != validPointers.end()) {
-            return true;
+        PointerValidationCache& cache = GetValidationCache();
+        const bool readable = cache.IsReadable(address, GetValidationGeneration());
+        if (cache.GetPendingLookups() >= PointerValidationConfig::COUNTER_FLUSH_INTERVAL) {
+            GetValidationTelemetry().Add(cache.TakeCounters());
         }
-        
-        MEMORY_BASIC_INFORMATION mbi = {};
-        SIZE_T result = VirtualQuery(ptr, &mbi, sizeof(mbi));
-        
-        if (result == 0) return false;
-        
-        // Check if memory is committed and readable
-        if (mbi.State != MEM_COMMIT) return false;
-        if (!(mbi.Protect & (PAGE_READONLY | PAGE_READWRITE | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE))) return false;
-        if (mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS)) return false;
-        
-        // Cache the valid pointer for future use
-        validPointers.emplace(address);
-        
-        return true;
+        return readable;
     }
 
     /**
      * @brief Validates if an object's VTable pointer resides within the game module
+     *
+     * Verdicts are cached per vtable (see VTableVerdictCache); with an expected kind, objects
+     * whose vtable is known to belong to another kind are rejected too.
+     *
      * @param pObject Pointer to the object whose VTable should be validated
+     * @param expected Class kind the caller's list holds, or Any
      * @return true if the VTable pointer is valid and within module bounds, false otherwise
      */
-    inline bool IsVTablePointerValid(void* pObject) {
+    inline bool IsVTablePointerValid(void* pObject, VTableKind expected = VTableKind::Any) {
         if (!pObject || !IsMemorySafe(pObject)) {
             return false;
         }
@@ -104,6 +138,7 @@ namespace SafeAccess {
         __try {
             vtablePtr = *reinterpret_cast<uintptr_t*>(pObject);
         } __except (EXCEPTION_EXECUTE_HANDLER) {
+            InvalidateRegion(reinterpret_cast<uintptr_t>(pObject));
             return false;
         }
 
@@ -116,8 +151,13 @@ namespace SafeAccess {
             return false;
         }
 
-        // Check if VTable pointer is within the game module bounds
-        return (vtablePtr >= moduleBase && vtablePtr < (moduleBase + moduleSize));
+        // Check if VTable pointer is within the game module bounds and of the expected kind
+        VTableVerdictCache& verdicts = GetVTableVerdictCache();
+        const bool valid = verdicts.Check(vtablePtr, expected, moduleBase, moduleSize) == VTableVerdictCache::Verdict::Valid;
+        if (verdicts.GetPendingLookups() >= PointerValidationConfig::COUNTER_FLUSH_INTERVAL) {
+            GetValidationTelemetry().Add(verdicts.TakeCounters());
+        }
+        return valid;
     }
 
 } // namespace SafeAccess
@@ -1,43 +1,83 @@
 #pragma once
-#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include "DebugLogger.h"
+#include <vector>
 
 namespace kx {
 
 /**
- * @brief Simple object pool to eliminate heap allocations in main loops
- * 
- * Pre-allocates a fixed number of objects and allows checking them out/returning them
- * to avoid repeated new/delete operations that cause heap churn and performance drops.
+ * @brief Growth and release policy of an ObjectPool
+ */
+struct ObjectPoolConfig {
+    size_t segmentSize = 256;               // Objects per segment; the pool grows one segment at a time
+    size_t maxSize = 4096;                  // Hard cap on objects checked out between two resets
+    uint32_t releaseIdleAfterResets = 0;    // Free segments unused for this many resets (0 = keep forever)
+};
+
+/**
+ * @brief Pool counters for capacity planning and diagnostics
+ */
+struct ObjectPoolStats {
+    size_t used = 0;                // Checked out since the last Reset()
+    size_t capacity = 0;            // Objects in allocated segments
+    size_t highWater = 0;           // Most objects ever checked out between two resets
+    size_t exhaustedRequests = 0;   // Get() calls refused since the last Reset() (maxSize reached)
+};
+
+/**
+ * @brief Segmented object pool to eliminate heap allocations in main loops
+ *
+ * Objects live in fixed-size segments that are allocated on demand and never move, so
+ * pointers handed out by Get() stay valid until the next Reset() even while the pool grows.
+ * Once a scene has warmed the pool up, checking objects out performs no allocations.
+ * Trailing segments that have not been needed for releaseIdleAfterResets resets are freed
+ * in Reset(), so the footprint follows the actual scene rather than the worst case.
  */
 template<typename T>
 class ObjectPool {
 private:
-    std::vector<T> m_pool;
+    struct Segment {
+        std::unique_ptr<T[]> objects;
+        uint64_t lastUsedReset = 0;
+    };
+
+    ObjectPoolConfig m_config;
+    std::vector<Segment> m_segments;
     size_t m_nextAvailable = 0;
+    size_t m_highWater = 0;
+    size_t m_exhaustedRequests = 0;
+    uint64_t m_resetCount = 0;
 
 public:
     /**
-     * @brief Constructor - pre-allocates the specified number of objects
-     * @param initialSize Number of objects to pre-allocate in the pool
+     * @brief Constructor - allocates the first segment up front
+     * @param config Segment size, size cap and idle release policy
      */
-    explicit ObjectPool(size_t initialSize) {
-        m_pool.resize(initialSize);
+    explicit ObjectPool(const ObjectPoolConfig& config) : m_config(config) {
+        m_config.segmentSize = (std::max<size_t>)(1, m_config.segmentSize);
+        m_segments.reserve((m_config.maxSize + m_config.segmentSize - 1) / m_config.segmentSize);
+        if (m_config.maxSize > 0) {
+            m_segments.push_back({ std::make_unique<T[]>(m_config.segmentSize), 0 });
+        }
     }
 
     /**
-     * @brief Get an object from the pool
-     * @return Pointer to an available object, or nullptr if pool is exhausted
+     * @brief Get an object from the pool, growing it by one segment if needed
+     * @return Pointer to an available object, or nullptr once maxSize objects are checked out
      */
     T* Get() {
-        if (m_nextAvailable >= m_pool.size()) {
-            // Pool is exhausted - log for debugging and capacity planning
-            LOG_WARN("ObjectPool<%s> exhausted: %zu objects requested, pool size: %zu", 
-                    typeid(T).name(), m_nextAvailable + 1, m_pool.size());
-            return nullptr; 
+        if (m_nextAvailable >= m_config.maxSize) {
+            ++m_exhaustedRequests;
+            return nullptr;
         }
-        return &m_pool[m_nextAvailable++];
+
+        const size_t segmentIndex = m_nextAvailable / m_config.segmentSize;
+        if (segmentIndex == m_segments.size()) {
+            m_segments.push_back({ std::make_unique<T[]>(m_config.segmentSize), m_resetCount });
+        }
+        return &m_segments[segmentIndex].objects[m_nextAvailable++ % m_config.segmentSize];
     }
 
     /**
@@ -45,14 +85,32 @@ public:
      * Call this at the beginning of each frame to "return" all objects to the pool
      */
     void Reset() {
+        ++m_resetCount;
+        m_highWater = (std::max)(m_highWater, m_nextAvailable);
+
+        const size_t segmentsUsed = (m_nextAvailable + m_config.segmentSize - 1) / m_config.segmentSize;
+        for (size_t i = 0; i < segmentsUsed; ++i) {
+            m_segments[i].lastUsedReset = m_resetCount;
+        }
+
+        // Release idle segments from the back only, so the live ones stay contiguous by index.
+        // The first segment is kept so a quiet scene doesn't allocate on every update.
+        if (m_config.releaseIdleAfterResets > 0) {
+            while (m_segments.size() > (std::max<size_t>)(segmentsUsed, 1) &&
+                   m_resetCount - m_segments.back().lastUsedReset >= m_config.releaseIdleAfterResets) {
+                m_segments.pop_back();
+            }
+        }
+
         m_nextAvailable = 0;
+        m_exhaustedRequests = 0;
     }
 
     /**
-     * @brief Get the total size of the pool
+     * @brief Get the number of objects in allocated segments
      */
     size_t Size() const {
-        return m_pool.size();
+        return m_segments.size() * m_config.segmentSize;
     }
 
     /**
@@ -63,11 +121,24 @@ public:
     }
 
     /**
-     * @brief Get the number of objects still available
+     * @brief Get the number of objects that can still be checked out before the cap
      */
     size_t Available() const {
-        return m_pool.size() - m_nextAvailable;
+        return m_config.maxSize - m_nextAvailable;
+    }
+
+    size_t GetSegmentCount() const {
+        return m_segments.size();
+    }
+
+    ObjectPoolStats GetStats() const {
+        ObjectPoolStats stats;
+        stats.used = m_nextAvailable;
+        stats.capacity = Size();
+        stats.highWater = (std::max)(m_highWater, m_nextAvailable);
+        stats.exhaustedRequests = m_exhaustedRequests;
+        return stats;
     }
 };
 
-} // namespace kx
\ No newline at end of file
+} // namespace kx
@@ -0,0 +1,99 @@
+#include "PointerValidationCache.h"
+
+#include <chrono>
+
+namespace kx {
+
+bool PointerValidationCache::TimedRegionSource::Query(uintptr_t address, MemoryRegionInfo& outRegion) {
+    const auto start = std::chrono::steady_clock::now();
+    const bool found = m_source.Query(address, outRegion);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ++m_counters.queries;
+    m_counters.queryNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    return found;
+}
+
+PointerValidationCache::PointerValidationCache(MemoryRegionSource& source)
+    : m_timedSource(source, m_counters),
+      m_regions(m_timedSource),
+      m_pages(std::make_unique<PageEntry[]>(PointerValidationConfig::PAGE_CACHE_ENTRIES)) {
+}
+
+bool PointerValidationCache::IsReadable(uintptr_t address, uint64_t generation) {
+    ++m_counters.lookups;
+
+    const uintptr_t page = address / PointerValidationConfig::PAGE_SIZE;
+    PageEntry& entry = m_pages[page & (PointerValidationConfig::PAGE_CACHE_ENTRIES - 1)];
+    if (entry.epoch == m_epoch && entry.page == page && generation < entry.validUntil) {
+        ++m_counters.pageHits;
+        return true;
+    }
+
+    const uint64_t queriesBefore = m_counters.queries;
+    uint64_t expiresAt = 0;
+    if (!m_regions.IsReadable(address, generation, &expiresAt)) {
+        return false;
+    }
+    if (m_counters.queries == queriesBefore) {
+        ++m_counters.regionHits;
+    }
+
+    entry.page = page;
+    entry.validUntil = expiresAt;
+    entry.epoch = m_epoch;
+    return true;
+}
+
+void PointerValidationCache::Invalidate(uintptr_t address) {
+    m_regions.Invalidate(address);
+
+    // The region may span many pages; dropping them all is cheaper than finding them
+    if (++m_epoch == 0) {
+        // Wrapped - entries from 4 billion invalidations ago could look current again
+        for (size_t i = 0; i < PointerValidationConfig::PAGE_CACHE_ENTRIES; ++i) {
+            m_pages[i] = PageEntry{};
+        }
+        m_epoch = 1;
+    }
+}
+
+PointerValidationCounters PointerValidationCache::TakeCounters() {
+    PointerValidationCounters counters = m_counters;
+    m_counters = PointerValidationCounters{};
+    return counters;
+}
+
+void PointerValidationTelemetry::Add(const PointerValidationCounters& counters) {
+    m_lookups.fetch_add(counters.lookups, std::memory_order_relaxed);
+    m_hits.fetch_add(counters.pageHits + counters.regionHits, std::memory_order_relaxed);
+    m_queries.fetch_add(counters.queries, std::memory_order_relaxed);
+    m_queryNanoseconds.fetch_add(counters.queryNanoseconds, std::memory_order_relaxed);
+}
+
+void PointerValidationTelemetry::Add(const VTableVerdictCounters& counters) {
+    m_vtableLookups.fetch_add(counters.lookups, std::memory_order_relaxed);
+    m_vtableHits.fetch_add(counters.hits, std::memory_order_relaxed);
+    m_vtableMistyped.fetch_add(counters.mistyped, std::memory_order_relaxed);
+}
+
+void PointerValidationTelemetry::EndUpdate() {
+    PointerValidationStats stats;
+    stats.lookups = m_lookups.exchange(0, std::memory_order_relaxed);
+    stats.hits = m_hits.exchange(0, std::memory_order_relaxed);
+    stats.queries = m_queries.exchange(0, std::memory_order_relaxed);
+    stats.queryMicroseconds = m_queryNanoseconds.exchange(0, std::memory_order_relaxed) / 1000;
+    stats.vtableLookups = m_vtableLookups.exchange(0, std::memory_order_relaxed);
+    stats.vtableHits = m_vtableHits.exchange(0, std::memory_order_relaxed);
+    stats.vtableMistyped = m_vtableMistyped.exchange(0, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(m_lastUpdateMutex);
+    m_lastUpdate = stats;
+}
+
+PointerValidationStats PointerValidationTelemetry::GetLastUpdate() const {
+    std::lock_guard<std::mutex> lock(m_lastUpdateMutex);
+    return m_lastUpdate;
+}
+
+} // namespace kx
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "MemoryRegionMap.h"
+#include "VTableVerdictCache.h"
+
+namespace kx {
+
+/**
+ * @brief PointerValidationCache configuration
+ */
+namespace PointerValidationConfig {
+    constexpr uint64_t GENERATION_MS = 100;          // One generation per 100ms of wall time
+    constexpr uintptr_t PAGE_SIZE = 0x1000;
+    constexpr size_t PAGE_CACHE_ENTRIES = 4096;      // Must be a power of two
+    constexpr uint64_t COUNTER_FLUSH_INTERVAL = 1024; // Lookups a thread counts locally before publishing
+
+    static_assert((PAGE_CACHE_ENTRIES & (PAGE_CACHE_ENTRIES - 1)) == 0, "PAGE_CACHE_ENTRIES must be a power of two");
+}
+
+/**
+ * @brief Counters one PointerValidationCache accumulates between flushes
+ */
+struct PointerValidationCounters {
+    uint64_t lookups = 0;
+    uint64_t pageHits = 0;          // Answered by the page cache
+    uint64_t regionHits = 0;        // Page miss answered by the region map
+    uint64_t queries = 0;           // Region source queries (VirtualQuery in the game)
+    uint64_t queryNanoseconds = 0;  // Time spent inside those queries
+};
+
+/**
+ * @brief Validation cost of one update, summed over every thread that validated pointers
+ */
+struct PointerValidationStats {
+    uint64_t lookups = 0;
+    uint64_t hits = 0;
+    uint64_t queries = 0;
+    uint64_t queryMicroseconds = 0;
+    uint64_t vtableLookups = 0;
+    uint64_t vtableHits = 0;
+    uint64_t vtableMistyped = 0;
+
+    float GetHitRate() const {
+        return lookups > 0 ? static_cast<float>(hits) / static_cast<float>(lookups) : 0.0f;
+    }
+
+    float GetVTableHitRate() const {
+        return vtableLookups > 0 ? static_cast<float>(vtableHits) / static_cast<float>(vtableLookups) : 0.0f;
+    }
+};
+
+/**
+ * @brief Bounded, page-granular readable-memory cache in front of a MemoryRegionMap
+ *
+ * A direct-mapped table of recently validated pages answers most lookups with a single
+ * compare. Each page entry is only trusted until the generation its region expires in, so
+ * pages age out together with the region map's staggered expiry instead of being wiped on
+ * a timer. Invalidate() drops the faulting region and flushes the page table by bumping
+ * its epoch.
+ *
+ * Not thread-safe; SafeAccess keeps one cache per thread.
+ */
+class PointerValidationCache {
+public:
+    explicit PointerValidationCache(MemoryRegionSource& source);
+
+    /**
+     * @brief Whether the address lies in committed, readable memory
+     * @param generation Current generation (see PointerValidationConfig::GENERATION_MS)
+     */
+    bool IsReadable(uintptr_t address, uint64_t generation);
+
+    /**
+     * @brief Forget everything known about the region containing an address
+     */
+    void Invalidate(uintptr_t address);
+
+    /**
+     * @brief Lookups counted since the last TakeCounters()
+     */
+    uint64_t GetPendingLookups() const { return m_counters.lookups; }
+
+    /**
+     * @brief Returns and resets the counters accumulated so far
+     */
+    PointerValidationCounters TakeCounters();
+
+    const MemoryRegionMap& GetRegionMap() const { return m_regions; }
+
+private:
+    /**
+     * @brief Forwards queries to the real source and times them
+     */
+    class TimedRegionSource : public MemoryRegionSource {
+    public:
+        TimedRegionSource(MemoryRegionSource& source, PointerValidationCounters& counters)
+            : m_source(source), m_counters(counters) {}
+
+        bool Query(uintptr_t address, MemoryRegionInfo& outRegion) override;
+
+    private:
+        MemoryRegionSource& m_source;
+        PointerValidationCounters& m_counters;
+    };
+
+    struct PageEntry {
+        uintptr_t page = 0;
+        uint64_t validUntil = 0; // Generation the entry stops being trusted in
+        uint32_t epoch = 0;      // Entry is stale unless it matches m_epoch
+    };
+
+    PointerValidationCounters m_counters;
+    TimedRegionSource m_timedSource;
+    MemoryRegionMap m_regions;
+    std::unique_ptr<PageEntry[]> m_pages;
+    uint32_t m_epoch = 1;
+};
+
+/**
+ * @brief Collects counters from every thread's cache and publishes them per update
+ *
+ * Threads Add() their local counters every few hundred lookups; the pipeline thread calls
+ * EndUpdate() once per extraction, which turns everything added since into the stats for
+ * that update.
+ */
+class PointerValidationTelemetry {
+public:
+    void Add(const PointerValidationCounters& counters);
+    void Add(const VTableVerdictCounters& counters);
+    void EndUpdate();
+    PointerValidationStats GetLastUpdate() const;
+
+private:
+    std::atomic<uint64_t> m_lookups{ 0 };
+    std::atomic<uint64_t> m_hits{ 0 };
+    std::atomic<uint64_t> m_queries{ 0 };
+    std::atomic<uint64_t> m_queryNanoseconds{ 0 };
+    std::atomic<uint64_t> m_vtableLookups{ 0 };
+    std::atomic<uint64_t> m_vtableHits{ 0 };
+    std::atomic<uint64_t> m_vtableMistyped{ 0 };
+
+    mutable std::mutex m_lastUpdateMutex;
+    PointerValidationStats m_lastUpdate;
+};
+
+} // namespace kx
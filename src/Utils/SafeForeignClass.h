@@ -2,8 +2,11 @@
 
 #include <windows.h> // Required for VirtualProtect
 #include <cstdint>   // Required for UINTPTR_MAX
+#include <cstring>   // Required for memcpy
+#include <type_traits>
 #include "MemorySafety.h"
 #include "DebugLogger.h"
+#include "ValidatedPtr.h"
 
 namespace kx {
 
@@ -20,6 +23,43 @@ namespace kx {
         static constexpr uintptr_t MAX_VTABLE_ADDRESS = 0x7FF000000000;    // x64 user space limit
     }
 
+    /**
+     * @brief Local copy of N bytes of a foreign struct, taken with one validation and one guarded read
+     *
+     * Fields are decoded from the copy with the same offsets ReadMember uses, and all of them
+     * come from the same instant. Offsets are template arguments so a field that doesn't fit
+     * in the block is a compile error rather than a silent default.
+     */
+    template<size_t N>
+    class MemoryBlock {
+    public:
+        [[nodiscard]] bool IsValid() const { return m_valid; }
+
+        /**
+         * @brief Decode a field from the copy
+         * @tparam T Field type
+         * @tparam Offset Field offset from the start of the block
+         * @param defaultValue Returned if the block could not be read
+         */
+        template<typename T, uintptr_t Offset>
+        [[nodiscard]] T Get(const T& defaultValue = T{}) const {
+            static_assert(Offset + sizeof(T) <= N, "Field lies outside the block");
+            static_assert(std::is_trivially_copyable_v<T>, "Fields must be trivially copyable");
+            if (!m_valid) {
+                return defaultValue;
+            }
+            T value;
+            memcpy(&value, m_bytes + Offset, sizeof(T));
+            return value;
+        }
+
+    private:
+        friend class SafeForeignClass;
+
+        alignas(8) unsigned char m_bytes[N];
+        bool m_valid = false;
+    };
+
     /**
      * @brief Memory-safe version of ForeignClass that validates all memory access
      * 
@@ -40,45 +80,60 @@ namespace kx {
     public:
         SafeForeignClass(void* ptr) : m_ptr(ptr) {
             // Critical validation on construction - nullify unsafe pointers immediately
-            if (ptr && !SafeAccess::IsMemorySafe(ptr)) {
-                m_ptr = nullptr; // Nullify unsafe pointers to prevent future crashes
+            Validate();
+        }
+
+        /**
+         * @brief Wrap a pointer that already carries a proof, skipping validation if it is still current
+         */
+        explicit SafeForeignClass(const ValidatedPtr& handle) : m_ptr(handle.ptr), m_validatedEpoch(handle.epoch) {
+            if (!handle.IsCurrent()) {
+                Validate();
             }
         }
 
-        // Copy constructor with validation
-        SafeForeignClass(const SafeForeignClass& other) : m_ptr(other.m_ptr) {
-            // Re-validate on copy to ensure safety
-            if (m_ptr && !SafeAccess::IsMemorySafe(m_ptr)) {
-                m_ptr = nullptr;
+        // Copies share the proof; only a proof from an earlier update triggers re-validation
+        SafeForeignClass(const SafeForeignClass& other) : m_ptr(other.m_ptr), m_validatedEpoch(other.m_validatedEpoch) {
+            if (!HasCurrentProof()) {
+                Validate();
             }
         }
 
-        // Assignment operator with validation
         SafeForeignClass& operator=(const SafeForeignClass& other) {
             if (this != &other) {
                 m_ptr = other.m_ptr;
-                // Re-validate on assignment
-                if (m_ptr && !SafeAccess::IsMemorySafe(m_ptr)) {
-                    m_ptr = nullptr;
+                m_validatedEpoch = other.m_validatedEpoch;
+                if (!HasCurrentProof()) {
+                    Validate();
                 }
             }
             return *this;
         }
 
         // Move constructor (safe since we validate on access)
-        SafeForeignClass(SafeForeignClass&& other) noexcept : m_ptr(other.m_ptr) {
+        SafeForeignClass(SafeForeignClass&& other) noexcept : m_ptr(other.m_ptr), m_validatedEpoch(other.m_validatedEpoch) {
             other.m_ptr = nullptr;
+            other.m_validatedEpoch = ValidationEpoch::NONE;
         }
 
         // Move assignment
         SafeForeignClass& operator=(SafeForeignClass&& other) noexcept {
             if (this != &other) {
                 m_ptr = other.m_ptr;
+                m_validatedEpoch = other.m_validatedEpoch;
                 other.m_ptr = nullptr;
+                other.m_validatedEpoch = ValidationEpoch::NONE;
             }
             return *this;
         }
 
+        /**
+         * @brief The pointer with its proof of validation, for handing on without re-validating
+         */
+        [[nodiscard]] ValidatedPtr Borrow() const {
+            return ValidatedPtr{ m_ptr, m_validatedEpoch };
+        }
+
         /**
          * @brief Read a member variable from foreign memory with comprehensive validation
          * @tparam T Type to read
@@ -93,13 +148,29 @@ namespace kx {
             }
             
             T result;
-            if (!Debug::SafeRead<T>(data(), offset, result)) {
+            if (!ReadField<T>(offset, result)) {
                 return defaultValue;
             }
             
             return result;
         }
 
+        /**
+         * @brief Copy N bytes starting at an offset for decoding several fields at once
+         * @tparam N Block size in bytes; must cover the last field to be decoded
+         * @param offset Offset from base pointer where the block starts
+         * @return The copied block; invalid if memory is unsafe or the read faulted
+         */
+        template<size_t N>
+        [[nodiscard]] MemoryBlock<N> ReadBlock(uintptr_t offset = 0) const {
+            static_assert(N <= SafeForeignClassLimits::MAX_REASONABLE_SIZE, "Block exceeds the maximum single access");
+            MemoryBlock<N> block;
+            if (data() && offset <= SafeForeignClassLimits::MAX_REASONABLE_OFFSET) {
+                block.m_valid = Debug::SafeReadBytes(data(), offset, block.m_bytes, N);
+            }
+            return block;
+        }
+
         /**
          * @brief Read a pointer from foreign memory and return wrapped in specified ReClass type
          * @tparam WrapperType The ReClass wrapper type to construct
@@ -113,7 +184,7 @@ namespace kx {
             }
             
             void* ptr = nullptr;
-            if (!kx::Debug::SafeRead<void*>(data(), offset, ptr)) {
+            if (!ReadField<void*>(offset, ptr)) {
                 return WrapperType(nullptr);
             }
             
@@ -134,7 +205,7 @@ namespace kx {
             }
             
             PtrType ptr = nullptr;
-            if (!Debug::SafeRead<PtrType>(data(), offset, ptr)) {
+            if (!ReadField<PtrType>(offset, ptr)) {
                 return WrapperType(nullptr);
             }
             
@@ -154,7 +225,7 @@ namespace kx {
             }
             
             ArrayType* arrayPtr = nullptr;
-            if (!Debug::SafeRead<ArrayType*>(data(), offset, arrayPtr)) {
+            if (!ReadField<ArrayType*>(offset, arrayPtr)) {
                 return nullptr;
             }
             
@@ -273,7 +344,15 @@ namespace kx {
          * @return true if the base pointer is valid and safe to access
          */
         [[nodiscard]] bool isValid() const {
-            return SafeAccess::IsMemorySafe(m_ptr);
+            if (HasCurrentProof()) {
+                return true;
+            }
+            const uint32_t epoch = ValidationEpoch::Current();
+            if (!SafeAccess::IsMemorySafe(m_ptr)) {
+                return false;
+            }
+            m_validatedEpoch = epoch;
+            return true;
         }
 
         /**
@@ -402,6 +481,7 @@ namespace kx {
          */
         void reset() {
             m_ptr = nullptr;
+            m_validatedEpoch = ValidationEpoch::NONE;
         }
 
         /**
@@ -410,14 +490,47 @@ namespace kx {
          */
         void reset(void* ptr) {
             m_ptr = ptr;
-            // Validate the new pointer
-            if (m_ptr && !SafeAccess::IsMemorySafe(m_ptr)) {
+            Validate();
+        }
+
+    private:
+        bool HasCurrentProof() const {
+            return m_validatedEpoch != ValidationEpoch::NONE && m_ptr && m_validatedEpoch == ValidationEpoch::Current();
+        }
+
+        // Nullify unsafe pointers to prevent future crashes; stamp safe ones with the current epoch
+        void Validate() {
+            const uint32_t epoch = ValidationEpoch::Current();
+            if (m_ptr && SafeAccess::IsMemorySafe(m_ptr)) {
+                m_validatedEpoch = epoch;
+            } else {
                 m_ptr = nullptr;
+                m_validatedEpoch = ValidationEpoch::NONE;
             }
         }
 
-    private:
+        /**
+         * @brief Read one field, skipping the region lookup when the proof covers its page
+         *
+         * Readability is decided per page, so a field on the same page as a base proven readable
+         * this update needs only the guarded read; anything further out is validated as usual.
+         */
+        template<typename T>
+        bool ReadField(uintptr_t offset, T& result) const {
+            constexpr uintptr_t PAGE_SIZE = PointerValidationConfig::PAGE_SIZE;
+            const uintptr_t base = address();
+            if (offset < PAGE_SIZE && (base & (PAGE_SIZE - 1)) + offset + sizeof(T) <= PAGE_SIZE && HasCurrentProof()) {
+                if (Debug::SafeReadImpl(base + offset, result)) {
+                    return true;
+                }
+                SafeAccess::InvalidateRegion(base + offset);
+                return false;
+            }
+            return Debug::SafeRead<T>(data(), offset, result);
+        }
+
         void* m_ptr;
+        mutable uint32_t m_validatedEpoch = ValidationEpoch::NONE; // Epoch m_ptr was last found readable in
     };
 
     // --- Comparison operators ---
@@ -24,7 +24,8 @@ namespace SafeAccess {
         void AdvanceToValid() {
             m_currentValid = false;
             while (m_index < m_capacity) {
-                if (IsMemorySafe(m_array[m_index]) && IsVTablePointerValid(m_array[m_index])) {
+                // IsVTablePointerValid checks the object itself is readable first, and rejects other classes' vtables
+                if (IsVTablePointerValid(m_array[m_index], VTableKind::Character)) {
                     m_current = ReClass::ChCliCharacter(m_array[m_index]);
                     if (m_current) {
                         m_currentValid = true;
@@ -106,7 +107,8 @@ namespace SafeAccess {
             m_currentValid = false;
             m_currentName = nullptr;
             while (m_index < m_capacity) {
-                if (IsMemorySafe(m_array[m_index]) && IsVTablePointerValid(m_array[m_index])) {
+                // IsVTablePointerValid checks the object itself is readable first, and rejects other classes' vtables
+                if (IsVTablePointerValid(m_array[m_index], VTableKind::Player)) {
                     m_currentPlayer = ReClass::ChCliPlayer(m_array[m_index]);
                     if (m_currentPlayer) {
                         m_currentCharacter = m_currentPlayer.GetCharacter();
@@ -198,7 +200,8 @@ namespace SafeAccess {
         void AdvanceToValid() {
             m_currentValid = false;
             while (m_index < m_capacity) {
-                if (IsMemorySafe(m_array[m_index]) && IsVTablePointerValid(m_array[m_index])) {
+                // IsVTablePointerValid checks the object itself is readable first, and rejects other classes' vtables
+                if (IsVTablePointerValid(m_array[m_index], VTableKind::Gadget)) {
                     m_current = ReClass::GdCliGadget(m_array[m_index]);
                     if (m_current) {
                         m_currentValid = true;
@@ -281,7 +284,7 @@ namespace SafeAccess {
                     m_current = ReClass::AgentInl(m_array[m_index]);
                     if (m_current) {
                         ReClass::AgKeyFramed agKeyframed = m_current.GetAgKeyFramed();
-                        if (agKeyframed && IsVTablePointerValid(agKeyframed.data())) {
+                        if (agKeyframed && IsVTablePointerValid(agKeyframed.data(), VTableKind::AgKeyframed)) {
                             m_currentValid = true;
                             return;
                         }
@@ -343,6 +346,22 @@ namespace SafeAccess {
         }
     };
 
+    /**
+     * @brief A begin/end pair over a sub-range of one of the list wrappers below
+     */
+    template<typename Iterator>
+    class IndexRange {
+    private:
+        Iterator m_begin;
+        Iterator m_end;
+
+    public:
+        IndexRange(Iterator first, Iterator last) : m_begin(first), m_end(last) {}
+
+        Iterator begin() const { return m_begin; }
+        Iterator end() const { return m_end; }
+    };
+
     /**
      * @brief Range wrapper for character lists to enable range-based for loops
      * 
@@ -372,6 +391,24 @@ namespace SafeAccess {
         CharacterListIterator end() const {
             return CharacterListIterator(m_array, m_capacity, m_capacity);
         }
+
+        /**
+         * @brief Number of slots in the backing array (0 if it failed the sanity check)
+         */
+        uint32_t Capacity() const {
+            return (m_array && m_capacity < MAX_REASONABLE_CHARACTER_COUNT) ? m_capacity : 0;
+        }
+
+        /**
+         * @brief Iterate only the array slots [first, last), used to split the list across workers
+         * @note last is clamped to Capacity(), so a corrupt capacity yields an empty range
+         */
+        IndexRange<CharacterListIterator> Range(uint32_t first, uint32_t last) const {
+            const uint32_t capacity = Capacity();
+            last = (last < capacity) ? last : capacity;
+            first = (first < last) ? first : last;
+            return IndexRange<CharacterListIterator>(CharacterListIterator(m_array, first, last), CharacterListIterator(m_array, last, last));
+        }
     };
 
     /**
@@ -434,6 +471,24 @@ namespace SafeAccess {
         GadgetListIterator end() const {
             return GadgetListIterator(m_array, m_capacity, m_capacity);
         }
+
+        /**
+         * @brief Number of slots in the backing array (0 if it failed the sanity check)
+         */
+        uint32_t Capacity() const {
+            return (m_array && m_capacity < MAX_REASONABLE_GADGET_COUNT) ? m_capacity : 0;
+        }
+
+        /**
+         * @brief Iterate only the array slots [first, last), used to split the list across workers
+         * @note last is clamped to Capacity(), so a corrupt capacity yields an empty range
+         */
+        IndexRange<GadgetListIterator> Range(uint32_t first, uint32_t last) const {
+            const uint32_t capacity = Capacity();
+            last = (last < capacity) ? last : capacity;
+            first = (first < last) ? first : last;
+            return IndexRange<GadgetListIterator>(GadgetListIterator(m_array, first, last), GadgetListIterator(m_array, last, last));
+        }
     };
 
     /**
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "ObjectPool.h"
+#include "ChunkedResults.h"
+
+namespace kx {
+
+/**
+ * @brief A fixed set of ObjectPools, one per extraction worker
+ *
+ * Each worker checks objects out of its own shard only, so parallel extraction needs no
+ * locking. Shards are cache-line aligned so the workers' bump counters never share a line.
+ * Every shard may grow to the full maxSize: with work stealing a single worker may end up
+ * processing the whole list, and it must not run out earlier than the serial path would.
+ * Shards only allocate the segments they actually use, so this costs no memory up front.
+ */
+template<typename T, size_t ShardCount>
+class ShardedObjectPool {
+private:
+    struct alignas(64) PoolShard {
+        ObjectPool<T> pool;
+        explicit PoolShard(const ObjectPoolConfig& config) : pool(config) {}
+    };
+
+    std::vector<PoolShard> m_shards;
+    size_t m_highWater = 0;
+
+public:
+    explicit ShardedObjectPool(const ObjectPoolConfig& configPerShard) {
+        m_shards.reserve(ShardCount);
+        for (size_t i = 0; i < ShardCount; ++i) {
+            m_shards.emplace_back(configPerShard);
+        }
+    }
+
+    ObjectPool<T>& Shard(size_t workerIndex) {
+        return m_shards[workerIndex].pool;
+    }
+
+    static constexpr size_t GetShardCount() {
+        return ShardCount;
+    }
+
+    /**
+     * @brief Reset every shard
+     */
+    void Reset() {
+        m_highWater = (std::max)(m_highWater, Used());
+        for (auto& shard : m_shards) {
+            shard.pool.Reset();
+        }
+    }
+
+    /**
+     * @brief Total objects checked out across all shards
+     */
+    size_t Used() const {
+        size_t used = 0;
+        for (const auto& shard : m_shards) {
+            used += shard.pool.Used();
+        }
+        return used;
+    }
+
+    /**
+     * @brief Counters summed over all shards; highWater is of the combined count
+     */
+    ObjectPoolStats GetStats() const {
+        ObjectPoolStats stats;
+        for (const auto& shard : m_shards) {
+            const ObjectPoolStats shardStats = shard.pool.GetStats();
+            stats.used += shardStats.used;
+            stats.capacity += shardStats.capacity;
+            stats.exhaustedRequests += shardStats.exhaustedRequests;
+        }
+        stats.highWater = (std::max)(m_highWater, stats.used);
+        return stats;
+    }
+};
+
+} // namespace kx
@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace kx {
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer ring buffer
+ *
+ * The producer owns the tail, the consumer the head; each only reads the other's index.
+ * TryPush fails instead of overwriting when the consumer has fallen a full ring behind,
+ * so a slow consumer loses the newest items, never sees torn ones.
+ *
+ * @tparam Capacity Must be a power of two
+ */
+template<typename T, size_t Capacity>
+class SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+private:
+    std::unique_ptr<T[]> m_items = std::make_unique<T[]>(Capacity);
+    alignas(64) std::atomic<uint64_t> m_head{ 0 }; // Next item to pop (consumer-owned)
+    alignas(64) std::atomic<uint64_t> m_tail{ 0 }; // Next slot to fill (producer-owned)
+
+public:
+    SpscRing() = default;
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * @brief Append an item (producer thread only)
+     * @return False if the ring is full and the item was dropped
+     */
+    bool TryPush(const T& item) {
+        const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) >= Capacity) {
+            return false;
+        }
+        m_items[tail & (Capacity - 1)] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest item (consumer thread only)
+     * @return False if the ring is empty
+     */
+    bool TryPop(T& out) {
+        const uint64_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = m_items[head & (Capacity - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t GetSize() const {
+        return static_cast<size_t>(m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire));
+    }
+
+    static constexpr size_t GetCapacity() { return Capacity; }
+};
+
+} // namespace kx
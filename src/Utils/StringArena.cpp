@@ -0,0 +1,170 @@
+#include "StringArena.h"
+
+#include <cstring>
+
+namespace kx {
+
+namespace {
+    uint32_t SizeClassFor(size_t length) {
+        for (uint32_t i = 0; i < StringArenaConfig::SIZE_CLASS_COUNT; ++i) {
+            if (length <= StringArenaConfig::SIZE_CLASSES[i]) {
+                return i;
+            }
+        }
+        return StringArenaConfig::SIZE_CLASS_COUNT - 1;
+    }
+
+    std::string_view TruncateUtf8(std::string_view text) {
+        if (text.size() <= StringArenaConfig::MAX_STRING_LENGTH) {
+            return text;
+        }
+
+        // Don't cut a multi-byte sequence in half
+        size_t length = StringArenaConfig::MAX_STRING_LENGTH;
+        while (length > 0 && (static_cast<unsigned char>(text[length]) & 0xC0) == 0x80) {
+            --length;
+        }
+        return text.substr(0, length);
+    }
+}
+
+StringArena::StringArena()
+    : m_slots(std::make_unique<Slot[]>(StringArenaConfig::MAX_STRINGS)),
+      m_lookup(LookupMap::allocator_type(&m_heapAllocations)) {
+    // Size everything that would otherwise grow while interning
+    m_freeSlots.reserve(StringArenaConfig::MAX_STRINGS);
+    m_lookup.reserve(StringArenaConfig::MAX_STRINGS);
+    m_blocks.reserve(StringArenaConfig::MAX_STRINGS * StringArenaConfig::MAX_STRING_LENGTH / StringArenaConfig::BLOCK_SIZE);
+}
+
+StringArena::~StringArena() = default;
+
+StringHandle StringArena::Intern(std::string_view text) {
+    text = TruncateUtf8(text);
+    if (text.empty()) {
+        return {};
+    }
+
+    auto existing = m_lookup.find(text);
+    if (existing != m_lookup.end()) {
+        Slot& slot = m_slots[existing->second];
+        slot.lastUsedUpdate = m_updateIndex;
+        return { existing->second, slot.generation.load(std::memory_order_relaxed) };
+    }
+
+    uint32_t index;
+    if (!m_freeSlots.empty()) {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else if (m_slotHighWater < StringArenaConfig::MAX_STRINGS) {
+        index = m_slotHighWater++;
+    } else {
+        return {}; // Arena full - the entity is drawn without a name
+    }
+
+    Slot& slot = m_slots[index];
+    slot.sizeClass = SizeClassFor(text.size());
+    char* storage = AllocateStorage(slot.sizeClass);
+    std::memcpy(storage, text.data(), text.size());
+    slot.data = storage;
+    slot.length = static_cast<uint32_t>(text.size());
+    slot.lastUsedUpdate = m_updateIndex;
+
+    // Publish the entry: odd generations are live
+    const uint32_t generation = slot.generation.load(std::memory_order_relaxed) + 1;
+    slot.generation.store(generation, std::memory_order_release);
+
+    m_lookup.emplace(std::string_view(storage, text.size()), index);
+    return { index, generation };
+}
+
+void StringArena::Touch(StringHandle handle) {
+    if (!handle.IsValid() || handle.index >= m_slotHighWater) {
+        return;
+    }
+
+    Slot& slot = m_slots[handle.index];
+    if (slot.generation.load(std::memory_order_relaxed) == handle.generation) {
+        slot.lastUsedUpdate = m_updateIndex;
+    }
+}
+
+std::string_view StringArena::Resolve(StringHandle handle) const {
+    if (!handle.IsValid() || handle.index >= StringArenaConfig::MAX_STRINGS) {
+        return {};
+    }
+
+    const Slot& slot = m_slots[handle.index];
+    if (slot.generation.load(std::memory_order_acquire) != handle.generation) {
+        return {};
+    }
+    return std::string_view(slot.data, slot.length);
+}
+
+void StringArena::EndUpdate() {
+    uint32_t live = 0;
+    uint32_t reclaimed = 0;
+
+    for (uint32_t i = 0; i < m_slotHighWater; ++i) {
+        Slot& slot = m_slots[i];
+        const uint32_t generation = slot.generation.load(std::memory_order_relaxed);
+        if ((generation & 1) == 0) {
+            continue; // Free
+        }
+
+        if (m_updateIndex - slot.lastUsedUpdate < StringArenaConfig::RECLAIM_AFTER_UPDATES) {
+            ++live;
+            continue;
+        }
+
+        m_lookup.erase(std::string_view(slot.data, slot.length));
+        FreeStorageOf(slot);
+        slot.generation.store(generation + 1, std::memory_order_release);
+        m_freeSlots.push_back(i);
+        ++reclaimed;
+    }
+
+    m_publishedLive.store(live, std::memory_order_relaxed);
+    m_publishedReclaimed.store(reclaimed, std::memory_order_relaxed);
+    m_publishedReservedBytes.store(m_blocks.size() * StringArenaConfig::BLOCK_SIZE, std::memory_order_relaxed);
+    m_publishedHeapAllocations.store(m_heapAllocations, std::memory_order_relaxed);
+    ++m_updateIndex;
+}
+
+StringArenaStats StringArena::GetStats() const {
+    StringArenaStats stats;
+    stats.liveStrings = m_publishedLive.load(std::memory_order_relaxed);
+    stats.reclaimedLastUpdate = m_publishedReclaimed.load(std::memory_order_relaxed);
+    stats.reservedBytes = m_publishedReservedBytes.load(std::memory_order_relaxed);
+    stats.heapAllocations = m_publishedHeapAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+char* StringArena::AllocateStorage(uint32_t sizeClass) {
+    if (FreeStorage* recycled = m_freeStorage[sizeClass]) {
+        m_freeStorage[sizeClass] = recycled->next;
+        return reinterpret_cast<char*>(recycled);
+    }
+
+    const size_t size = StringArenaConfig::SIZE_CLASSES[sizeClass];
+    if (m_blockOffset + size > StringArenaConfig::BLOCK_SIZE) {
+        m_heapAllocations += (m_blocks.size() == m_blocks.capacity()) ? 2 : 1; // The block, and the table if it grows
+        m_blocks.push_back(std::make_unique<char[]>(StringArenaConfig::BLOCK_SIZE));
+        m_blockOffset = 0;
+    }
+
+    // Size classes are multiples of 16, so every allocation stays pointer-aligned
+    char* storage = m_blocks.back().get() + m_blockOffset;
+    m_blockOffset += size;
+    return storage;
+}
+
+void StringArena::FreeStorageOf(Slot& slot) {
+    auto* freed = reinterpret_cast<FreeStorage*>(const_cast<char*>(slot.data));
+    freed->next = m_freeStorage[slot.sizeClass];
+    m_freeStorage[slot.sizeClass] = freed;
+    slot.data = nullptr;
+    slot.length = 0;
+}
+
+} // namespace kx
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <ankerl/unordered_dense.h>
+
+namespace kx {
+
+/**
+ * @brief StringArena configuration
+ */
+namespace StringArenaConfig {
+    constexpr uint32_t MAX_STRINGS = 4096;            // Live interned strings; slot table is allocated up front
+    constexpr size_t BLOCK_SIZE = 64 * 1024;          // Character storage is carved out of blocks this size
+    constexpr size_t MAX_STRING_LENGTH = 256;         // Longer strings are truncated (on a UTF-8 boundary)
+    constexpr uint64_t RECLAIM_AFTER_UPDATES = 8;     // Must exceed how many updates a published snapshot can lag behind
+
+    // Storage size classes; freed storage is recycled within its class
+    constexpr size_t SIZE_CLASS_COUNT = 5;
+    constexpr size_t SIZE_CLASSES[SIZE_CLASS_COUNT] = { 16, 32, 64, 128, 256 };
+}
+
+/**
+ * @brief 8-byte handle to an interned string
+ *
+ * A default-constructed handle is the empty string. Handles are invalidated when the
+ * arena reclaims their string; resolving a stale handle yields an empty view.
+ */
+struct StringHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0; // 0 = empty / invalid
+
+    bool IsValid() const { return generation != 0; }
+    bool operator==(const StringHandle&) const = default;
+};
+
+static_assert(sizeof(StringHandle) == 8, "StringHandle must stay 8 bytes");
+
+/**
+ * @brief Snapshot of the arena counters for diagnostics
+ */
+struct StringArenaStats {
+    uint32_t liveStrings = 0;
+    uint32_t reclaimedLastUpdate = 0;
+    size_t reservedBytes = 0;
+    uint64_t heapAllocations = 0;  // Made by the arena since construction; flat once warmed up
+};
+
+/**
+ * @brief Interning arena for entity names
+ *
+ * Identical strings share one entry, and the characters of an entry never move, so the
+ * views returned by Resolve() stay valid for as long as the entry lives. An entry lives
+ * while someone calls Touch() (or Intern()) on it at least once every
+ * RECLAIM_AFTER_UPDATES updates; after that EndUpdate() reclaims it and recycles its
+ * slot and storage. Once the slot table and storage blocks have warmed up, interning,
+ * touching and reclaiming perform no heap allocations.
+ *
+ * Intern(), Touch() and EndUpdate() must be called from a single thread (the ESP pipeline
+ * thread). Resolve() may be called from any thread for handles produced within the last
+ * RECLAIM_AFTER_UPDATES updates, which covers every snapshot the render thread can hold.
+ */
+class StringArena {
+public:
+    StringArena();
+    ~StringArena();
+
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+
+    /**
+     * @brief Intern a string (or find the existing entry) and keep it alive for this update
+     * @return Handle to the entry, or an empty handle for empty text or when the arena is full
+     */
+    StringHandle Intern(std::string_view text);
+
+    /**
+     * @brief Keep an entry alive for this update
+     */
+    void Touch(StringHandle handle);
+
+    /**
+     * @brief Get the characters of an entry (empty for empty or stale handles)
+     */
+    std::string_view Resolve(StringHandle handle) const;
+
+    /**
+     * @brief Finish an update: reclaim entries that have not been touched recently
+     */
+    void EndUpdate();
+
+    StringArenaStats GetStats() const;
+
+private:
+    struct Slot {
+        const char* data = nullptr;
+        uint32_t length = 0;
+        uint32_t sizeClass = 0;
+        uint64_t lastUsedUpdate = 0;
+        std::atomic<uint32_t> generation{ 0 }; // Even = free, odd = live
+    };
+
+    // Freed storage is linked through its own first bytes
+    struct FreeStorage {
+        FreeStorage* next;
+    };
+
+    /**
+     * @brief std::allocator that adds each allocation to the arena's heap allocation count
+     */
+    template<typename T>
+    struct CountingAllocator {
+        using value_type = T;
+
+        uint64_t* count;
+
+        explicit CountingAllocator(uint64_t* counter) noexcept : count(counter) {}
+        template<typename U>
+        CountingAllocator(const CountingAllocator<U>& other) noexcept : count(other.count) {}
+
+        T* allocate(size_t n) {
+            ++*count;
+            return std::allocator<T>().allocate(n);
+        }
+        void deallocate(T* ptr, size_t n) noexcept { std::allocator<T>().deallocate(ptr, n); }
+
+        template<typename U>
+        bool operator==(const CountingAllocator<U>& other) const noexcept { return count == other.count; }
+    };
+
+    using LookupEntry = std::pair<std::string_view, uint32_t>;
+    using LookupMap = ankerl::unordered_dense::map<std::string_view, uint32_t,
+        ankerl::unordered_dense::hash<std::string_view>, std::equal_to<std::string_view>, CountingAllocator<LookupEntry>>;
+
+    char* AllocateStorage(uint32_t sizeClass);
+    void FreeStorageOf(Slot& slot);
+
+    uint64_t m_heapAllocations = 0;                // Pipeline thread only; published in EndUpdate()
+    std::unique_ptr<Slot[]> m_slots;
+    uint32_t m_slotHighWater = 0;                  // Slots [0, m_slotHighWater) have been used at least once
+    std::vector<uint32_t> m_freeSlots;             // Reserved to MAX_STRINGS up front, so never grows
+    LookupMap m_lookup;
+
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    size_t m_blockOffset = StringArenaConfig::BLOCK_SIZE;
+    FreeStorage* m_freeStorage[StringArenaConfig::SIZE_CLASS_COUNT] = {};
+
+    uint64_t m_updateIndex = 1;
+    std::atomic<uint32_t> m_publishedLive{ 0 };
+    std::atomic<uint32_t> m_publishedReclaimed{ 0 };
+    std::atomic<size_t> m_publishedReservedBytes{ 0 };
+    std::atomic<uint64_t> m_publishedHeapAllocations{ 0 };
+};
+
+} // namespace kx
@@ -0,0 +1,100 @@
+#include "TimingWheel.h"
+
+namespace kx {
+
+namespace {
+    constexpr uint64_t BUCKET_MASK = TimingWheelConfig::BUCKETS - 1;
+}
+
+void TimingWheel::Schedule(uint32_t id, uint64_t deadline) {
+    File(Timer{ deadline, id });
+    ++m_pending;
+}
+
+void TimingWheel::File(const Timer& timer) {
+    using namespace TimingWheelConfig;
+
+    // Deadlines already behind the wheel go into the next bucket to be drained
+    uint64_t tick = timer.deadline / TICK_MS;
+    if (tick < m_nextTick) {
+        tick = m_nextTick;
+    }
+
+    const uint64_t delta = tick - m_nextTick;
+    if (delta < BUCKETS) {
+        m_inner[tick & BUCKET_MASK].push_back(timer);
+    } else if (delta < HORIZON_TICKS) {
+        m_outer[(tick >> BUCKET_BITS) & BUCKET_MASK].push_back(timer);
+    } else {
+        // Beyond the horizon: park in the outer bucket that comes round last, then re-file
+        m_outer[((m_nextTick >> BUCKET_BITS) + BUCKETS - 1) & BUCKET_MASK].push_back(timer);
+    }
+}
+
+void TimingWheel::Cascade(uint64_t tick) {
+    // Spread the outer bucket for this block of ticks over the inner wheel (or further out)
+    Bucket& bucket = m_outer[(tick >> TimingWheelConfig::BUCKET_BITS) & BUCKET_MASK];
+    m_refile.swap(bucket);
+    for (const Timer& timer : m_refile) {
+        File(timer);
+    }
+    m_refile.clear();
+}
+
+void TimingWheel::CollectExpired(uint64_t now) {
+    using namespace TimingWheelConfig;
+
+    const uint64_t nowTick = now / TICK_MS;
+    if (nowTick < m_nextTick) {
+        return; // Clock went backwards; wait for it to catch up
+    }
+
+    if (nowTick - m_nextTick >= HORIZON_TICKS) {
+        // Long gap (or first use): cheaper to re-file everything than to walk every tick
+        for (Bucket* wheel : { m_inner.data(), m_outer.data() }) {
+            for (size_t i = 0; i < BUCKETS; ++i) {
+                m_refile.insert(m_refile.end(), wheel[i].begin(), wheel[i].end());
+                wheel[i].clear();
+            }
+        }
+        m_nextTick = nowTick;
+        for (const Timer& timer : m_refile) {
+            if (timer.deadline <= now) {
+                m_expired.push_back(timer);
+            } else {
+                File(timer);
+            }
+        }
+        m_refile.clear();
+    }
+
+    // Whole ticks behind now: everything in their buckets has expired
+    while (m_nextTick < nowTick) {
+        if ((m_nextTick & BUCKET_MASK) == 0) {
+            Cascade(m_nextTick);
+        }
+        Bucket& bucket = m_inner[m_nextTick & BUCKET_MASK];
+        m_expired.insert(m_expired.end(), bucket.begin(), bucket.end());
+        bucket.clear();
+        ++m_nextTick;
+    }
+
+    // The current tick: only the part of it that has passed
+    if ((nowTick & BUCKET_MASK) == 0) {
+        Cascade(nowTick);
+    }
+    Bucket& current = m_inner[nowTick & BUCKET_MASK];
+    for (size_t i = 0; i < current.size();) {
+        if (current[i].deadline <= now) {
+            m_expired.push_back(current[i]);
+            current[i] = current.back();
+            current.pop_back();
+        } else {
+            ++i;
+        }
+    }
+
+    m_pending -= m_expired.size();
+}
+
+} // namespace kx
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace kx {
+
+/**
+ * @brief TimingWheel configuration
+ *
+ * Two levels of 64 buckets: the inner wheel covers the next 640ms at 10ms per bucket, the
+ * outer one the next ~41 seconds at 640ms per bucket. Timers further out than that sit in
+ * the outer wheel's last bucket and are re-filed whenever it comes round.
+ */
+namespace TimingWheelConfig {
+    constexpr uint64_t TICK_MS = 10;
+    constexpr uint32_t BUCKET_BITS = 6;
+    constexpr uint32_t BUCKETS = 1u << BUCKET_BITS;
+    constexpr uint64_t HORIZON_TICKS = uint64_t{ BUCKETS } * BUCKETS;
+}
+
+/**
+ * @brief Hierarchical timing wheel of millisecond deadlines
+ *
+ * Schedule() files a timer in O(1); Advance() visits only the buckets between the previous
+ * and the current time and fires every timer whose deadline has passed, to the millisecond,
+ * so a timer fires in the same Advance() a per-update "now >= deadline" check would have
+ * caught it in. Buckets keep their capacity, so a steady load allocates nothing.
+ *
+ * There is no cancellation: owners reschedule freely and ignore fired timers that no longer
+ * match the deadline they expect.
+ *
+ * Not thread-safe.
+ */
+class TimingWheel {
+public:
+    struct Timer {
+        uint64_t deadline;
+        uint32_t id;
+    };
+
+    /**
+     * @brief Fire id once deadline (in ms, same clock as Advance) has passed
+     */
+    void Schedule(uint32_t id, uint64_t deadline);
+
+    /**
+     * @brief Move the wheel to now and call onFire(id, deadline) for every expired timer
+     */
+    template<typename OnFire>
+    void Advance(uint64_t now, OnFire&& onFire) {
+        CollectExpired(now);
+        for (const Timer& timer : m_expired) {
+            onFire(timer.id, timer.deadline);
+        }
+        m_expired.clear();
+    }
+
+    /**
+     * @brief Timers filed and not yet fired (including ones their owner has since replaced)
+     */
+    size_t GetPendingCount() const { return m_pending; }
+
+private:
+    using Bucket = std::vector<Timer>;
+
+    void CollectExpired(uint64_t now);
+    void File(const Timer& timer);
+    void Cascade(uint64_t tick);
+
+    std::array<Bucket, TimingWheelConfig::BUCKETS> m_inner;
+    std::array<Bucket, TimingWheelConfig::BUCKETS> m_outer;
+    Bucket m_expired;
+    Bucket m_refile;
+    uint64_t m_nextTick = 0;   // First tick whose bucket has not been drained yet
+    bool m_started = false;
+    size_t m_pending = 0;
+};
+
+} // namespace kx
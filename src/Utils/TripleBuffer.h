@@ -0,0 +1,75 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace kx {
+
+/**
+ * @brief Lock-free single-producer/single-consumer triple buffer
+ *
+ * The producer always owns one slot (back), the consumer always owns one slot (front),
+ * and the third slot (middle) is exchanged atomically between them. Publishing never
+ * blocks the consumer and acquiring never blocks the producer; the consumer simply
+ * picks up the newest completed slot, skipping any it did not get to in time.
+ *
+ * Slots are reused, so T should retain its capacity across resets to stay allocation-free.
+ */
+template<typename T>
+class TripleBuffer {
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t DIRTY_BIT = 0x4;
+
+    std::array<T, 3> m_slots;
+    alignas(64) std::atomic<uint8_t> m_middle{ 1 };
+    alignas(64) uint8_t m_back = 2;  // Producer-owned
+    alignas(64) uint8_t m_front = 0; // Consumer-owned
+
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Get the slot the producer is currently allowed to write (producer thread only)
+     */
+    T& WriteBuffer() {
+        return m_slots[m_back];
+    }
+
+    /**
+     * @brief Publish the write slot as the newest completed value (producer thread only)
+     * After this call WriteBuffer() returns a different slot.
+     */
+    void Publish() {
+        const uint8_t previous = m_middle.exchange(static_cast<uint8_t>(m_back | DIRTY_BIT), std::memory_order_acq_rel);
+        m_back = previous & INDEX_MASK;
+    }
+
+    /**
+     * @brief Swap in the newest published slot if there is one (consumer thread only)
+     * @return True if a new value was picked up, false if the front slot is still the newest
+     */
+    bool Acquire() {
+        if ((m_middle.load(std::memory_order_relaxed) & DIRTY_BIT) == 0) {
+            return false;
+        }
+        const uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Get the slot most recently picked up by Acquire() (consumer thread only)
+     */
+    T& ReadBuffer() {
+        return m_slots[m_front];
+    }
+
+    const T& ReadBuffer() const {
+        return m_slots[m_front];
+    }
+};
+
+} // namespace kx
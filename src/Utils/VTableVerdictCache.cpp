@@ -0,0 +1,63 @@
+#include "VTableVerdictCache.h"
+
+namespace kx {
+
+size_t VTableVerdictCache::SlotFor(uintptr_t vtable) {
+    // Vtables are 8-byte aligned and packed together in .rdata
+    const uintptr_t bits = vtable >> 3;
+    return (bits ^ (bits >> 8)) & (VTableVerdictConfig::ENTRIES - 1);
+}
+
+VTableVerdictCache::Verdict VTableVerdictCache::Check(uintptr_t vtable, VTableKind expected,
+                                                      uintptr_t moduleBase, size_t moduleSize) {
+    ++m_counters.lookups;
+
+    if (moduleBase != m_moduleBase || moduleSize != m_moduleSize) {
+        Clear();
+        m_moduleBase = moduleBase;
+        m_moduleSize = moduleSize;
+    }
+
+    Entry& entry = m_entries[SlotFor(vtable)];
+    if (vtable != 0 && entry.vtable == vtable) {
+        ++m_counters.hits;
+    } else {
+        if (vtable < moduleBase || vtable - moduleBase >= moduleSize) {
+            return Verdict::OutsideModule;
+        }
+        entry = Entry{ vtable, 0, VTableKind::Any };
+    }
+
+    if (expected == VTableKind::Any || entry.kind == VTableKind::Shared) {
+        return Verdict::Valid;
+    }
+
+    if (entry.kind == expected || entry.kind == VTableKind::Any) {
+        entry.kind = expected;
+        if (entry.sightings < VTableVerdictConfig::TRUSTED_SIGHTINGS) {
+            ++entry.sightings;
+        }
+        return Verdict::Valid;
+    }
+
+    if (entry.sightings >= VTableVerdictConfig::TRUSTED_SIGHTINGS) {
+        ++m_counters.mistyped;
+        return Verdict::WrongKind;
+    }
+
+    // Two lists claimed it before either was sure - stop judging this vtable by kind
+    entry.kind = VTableKind::Shared;
+    return Verdict::Valid;
+}
+
+void VTableVerdictCache::Clear() {
+    m_entries.fill(Entry{});
+}
+
+VTableVerdictCounters VTableVerdictCache::TakeCounters() {
+    VTableVerdictCounters counters = m_counters;
+    m_counters = VTableVerdictCounters{};
+    return counters;
+}
+
+} // namespace kx
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace kx {
+
+/**
+ * @brief VTableVerdictCache configuration
+ */
+namespace VTableVerdictConfig {
+    constexpr size_t ENTRIES = 256;              // Must be a power of two; the lists hold a few dozen classes
+    constexpr uint16_t TRUSTED_SIGHTINGS = 64;   // Sightings before a vtable's kind is used to reject entries
+
+    static_assert((ENTRIES & (ENTRIES - 1)) == 0, "ENTRIES must be a power of two");
+}
+
+/**
+ * @brief The class family a list expects its entries to belong to
+ */
+enum class VTableKind : uint8_t {
+    Any = 0,        // No expectation; only the module-bounds verdict applies
+    Character,
+    Player,
+    Gadget,
+    AgKeyframed,
+    CoChar,
+    Shared          // Seen under two kinds before either was trusted; never rejected
+};
+
+/**
+ * @brief Counters one VTableVerdictCache accumulates between flushes
+ */
+struct VTableVerdictCounters {
+    uint64_t lookups = 0;
+    uint64_t hits = 0;      // Answered without recomputing the verdict
+    uint64_t mistyped = 0;  // Rejected because the vtable belongs to another kind
+};
+
+/**
+ * @brief Direct-mapped cache from vtable pointer to its verdict and the class kind it belongs to
+ *
+ * Every list entry's vtable gets the same module-bounds check, and the lists only hold a
+ * handful of distinct classes, so verdicts are remembered per vtable. A vtable's kind is
+ * learned from the list it shows up in; once it has been seen TRUSTED_SIGHTINGS times under
+ * one kind, an entry with that vtable in a list expecting another kind (a gadget left in a
+ * character slot) is rejected before anything else is read from it. A vtable seen under two
+ * kinds before reaching that count is marked Shared and never rejected.
+ *
+ * Only in-module verdicts are stored, so garbage from freed slots never evicts real classes.
+ * Not thread-safe; SafeAccess keeps one cache per thread.
+ */
+class VTableVerdictCache {
+public:
+    enum class Verdict : uint8_t {
+        Valid,
+        OutsideModule,
+        WrongKind
+    };
+
+    /**
+     * @brief Classify a vtable pointer read from an object the caller expects to be of a kind
+     * @param moduleBase,moduleSize Bounds of the game module; a change drops every verdict
+     */
+    Verdict Check(uintptr_t vtable, VTableKind expected, uintptr_t moduleBase, size_t moduleSize);
+
+    void Clear();
+
+    /**
+     * @brief Lookups counted since the last TakeCounters()
+     */
+    uint64_t GetPendingLookups() const { return m_counters.lookups; }
+
+    /**
+     * @brief Returns and resets the counters accumulated so far
+     */
+    VTableVerdictCounters TakeCounters();
+
+private:
+    struct Entry {
+        uintptr_t vtable = 0;   // 0 marks an empty slot
+        uint16_t sightings = 0; // Saturates at TRUSTED_SIGHTINGS
+        VTableKind kind = VTableKind::Any;
+    };
+
+    static size_t SlotFor(uintptr_t vtable);
+
+    std::array<Entry, VTableVerdictConfig::ENTRIES> m_entries{};
+    uintptr_t m_moduleBase = 0;
+    size_t m_moduleSize = 0;
+    VTableVerdictCounters m_counters;
+};
+
+} // namespace kx
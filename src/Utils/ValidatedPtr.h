@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace kx {
+
+/**
+ * @brief Update-scoped epoch that validation proofs are issued against
+ *
+ * A pointer checked with IsMemorySafe during epoch N is trusted for the rest of epoch N.
+ * SafeAccess advances the epoch once per extraction update and whenever a guarded read
+ * faults, so a proof never outlives the update it was made in, nor a known-stale region.
+ * Epoch NONE (0) is never current: proofs issued in it are never honoured.
+ */
+namespace ValidationEpoch {
+    constexpr uint32_t NONE = 0;
+
+    namespace Detail {
+        inline std::atomic<uint32_t>*& ThreadEpoch() {
+            thread_local std::atomic<uint32_t>* epoch = nullptr; // Set by ScopedLocalEpoch
+            return epoch;
+        }
+    }
+
+    inline std::atomic<uint32_t>& Storage() {
+        if (std::atomic<uint32_t>* local = Detail::ThreadEpoch()) {
+            return *local;
+        }
+        static std::atomic<uint32_t> epoch{ 1 };
+        return epoch;
+    }
+
+    inline uint32_t Current() {
+        return Storage().load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Revoke every outstanding proof
+     */
+    inline void Advance() {
+        if (Storage().fetch_add(1, std::memory_order_acq_rel) + 1 == NONE) {
+            Storage().fetch_add(1, std::memory_order_acq_rel); // Skip NONE on wrap-around
+        }
+    }
+
+    /**
+     * @brief Stop honouring proofs until the next Advance() (every copy re-validates, as it used to)
+     * @note For measuring the validation savings in tests, inside a ScopedLocalEpoch
+     */
+    inline void Suspend() {
+        Storage().store(NONE, std::memory_order_release);
+    }
+
+    /**
+     * @brief Gives the calling thread an epoch of its own while in scope
+     *
+     * Test seam: the tests run inside the DLL next to the live pipeline, so they advance,
+     * suspend and wrap this epoch instead of the shared one. Proofs issued on this thread
+     * are checked against it, and faults on this thread advance it.
+     */
+    class ScopedLocalEpoch {
+    public:
+        ScopedLocalEpoch() : m_previous(Detail::ThreadEpoch()) { Detail::ThreadEpoch() = &m_epoch; }
+        ~ScopedLocalEpoch() { Detail::ThreadEpoch() = m_previous; }
+
+        ScopedLocalEpoch(const ScopedLocalEpoch&) = delete;
+        ScopedLocalEpoch& operator=(const ScopedLocalEpoch&) = delete;
+
+    private:
+        std::atomic<uint32_t> m_epoch{ 1 };
+        std::atomic<uint32_t>* m_previous;
+    };
+}
+
+/**
+ * @brief A pointer together with the epoch it was found readable in
+ *
+ * Copying or moving one costs nothing; whoever holds it can skip re-validation for as long
+ * as IsCurrent() holds.
+ */
+struct ValidatedPtr {
+    void* ptr = nullptr;
+    uint32_t epoch = ValidationEpoch::NONE;
+
+    [[nodiscard]] bool IsCurrent() const {
+        return ptr && epoch != ValidationEpoch::NONE && epoch == ValidationEpoch::Current();
+    }
+
+    /**
+     * @brief Issue a proof for a pointer the caller has just validated
+     */
+    static ValidatedPtr Vouch(void* validatedPtr) {
+        return ValidatedPtr{ validatedPtr, ValidationEpoch::Current() };
+    }
+};
+
+} // namespace kx
@@ -0,0 +1,130 @@
+#include "WorkStealingPool.h"
+
+namespace kx {
+
+WorkStealingPool::~WorkStealingPool() {
+    Stop();
+}
+
+void WorkStealingPool::Start(size_t helperThreadCount) {
+    if (!m_queues.empty()) {
+        return;
+    }
+
+    // Queue 0 belongs to whichever thread calls ParallelFor()
+    m_queues.reserve(helperThreadCount + 1);
+    for (size_t i = 0; i < helperThreadCount + 1; ++i) {
+        m_queues.push_back(std::make_unique<TaskQueue>());
+    }
+
+    m_threads.reserve(helperThreadCount);
+    for (size_t i = 0; i < helperThreadCount; ++i) {
+        const size_t workerIndex = i + 1;
+        m_threads.emplace_back([this, workerIndex](std::stop_token stopToken) { WorkerLoop(stopToken, workerIndex); });
+    }
+}
+
+void WorkStealingPool::Stop() {
+    if (m_queues.empty()) {
+        return;
+    }
+
+    for (auto& thread : m_threads) {
+        thread.request_stop();
+    }
+    m_batchGeneration.fetch_add(1, std::memory_order_release);
+    m_batchGeneration.notify_all();
+
+    m_threads.clear(); // jthread joins on destruction
+    m_queues.clear();
+}
+
+void WorkStealingPool::ParallelFor(size_t taskCount, const TaskFunction& task) {
+    if (taskCount == 0) {
+        return;
+    }
+
+    const size_t participants = m_queues.size();
+    if (participants <= 1 || taskCount == 1) {
+        for (size_t i = 0; i < taskCount; ++i) {
+            task(i, 0);
+        }
+        return;
+    }
+
+    m_task = &task;
+    m_remainingTasks.store(taskCount, std::memory_order_release);
+
+    // Contiguous blocks per participant keep neighbouring ranges on the same thread
+    for (size_t p = 0; p < participants; ++p) {
+        const size_t first = taskCount * p / participants;
+        const size_t last = taskCount * (p + 1) / participants;
+
+        std::lock_guard lock(m_queues[p]->mutex);
+        for (size_t i = first; i < last; ++i) {
+            m_queues[p]->tasks.push_back(i);
+        }
+    }
+
+    m_batchGeneration.fetch_add(1, std::memory_order_release);
+    m_batchGeneration.notify_all();
+
+    DrainTasks(0);
+
+    // Wait for tasks that helpers popped but haven't finished yet
+    size_t remaining;
+    while ((remaining = m_remainingTasks.load(std::memory_order_acquire)) != 0) {
+        m_remainingTasks.wait(remaining, std::memory_order_acquire);
+    }
+    m_task = nullptr;
+}
+
+void WorkStealingPool::WorkerLoop(std::stop_token stopToken, size_t workerIndex) {
+    uint64_t seenGeneration = m_batchGeneration.load(std::memory_order_acquire);
+    while (!stopToken.stop_requested()) {
+        m_batchGeneration.wait(seenGeneration, std::memory_order_acquire);
+        seenGeneration = m_batchGeneration.load(std::memory_order_acquire);
+        if (stopToken.stop_requested()) {
+            break;
+        }
+        DrainTasks(workerIndex);
+    }
+}
+
+bool WorkStealingPool::TryPopLocal(size_t workerIndex, size_t& outTask) {
+    TaskQueue& queue = *m_queues[workerIndex];
+    std::lock_guard lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    outTask = queue.tasks.front();
+    queue.tasks.pop_front();
+    return true;
+}
+
+bool WorkStealingPool::TrySteal(size_t workerIndex, size_t& outTask) {
+    const size_t participants = m_queues.size();
+    for (size_t offset = 1; offset < participants; ++offset) {
+        TaskQueue& victim = *m_queues[(workerIndex + offset) % participants];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            // Take from the far end so the owner keeps walking its block in order
+            outTask = victim.tasks.back();
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::DrainTasks(size_t workerIndex) {
+    size_t taskIndex;
+    while (TryPopLocal(workerIndex, taskIndex) || TrySteal(workerIndex, taskIndex)) {
+        (*m_task)(taskIndex, workerIndex);
+        if (m_remainingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            m_remainingTasks.notify_all();
+        }
+    }
+}
+
+} // namespace kx
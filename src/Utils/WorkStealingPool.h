@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace kx {
+
+/**
+ * @brief Small fork-join thread pool with per-worker task deques and work stealing
+ *
+ * ParallelFor() hands out task indices in contiguous blocks, one block per participant,
+ * so neighbouring tasks (and the memory they touch) stay on the same core. A participant
+ * pops from the front of its own deque and, once that runs dry, steals from the back of
+ * the others, so a slow or descheduled thread doesn't hold up the whole batch.
+ *
+ * The calling thread always participates as worker 0, which means a pool started with
+ * zero helper threads (or never started) simply runs every task inline. Only one
+ * ParallelFor() may be in flight at a time.
+ */
+class WorkStealingPool {
+public:
+    using TaskFunction = std::function<void(size_t taskIndex, size_t workerIndex)>;
+
+    WorkStealingPool() = default;
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Spawn the helper threads
+     * @param helperThreadCount Threads in addition to the calling thread
+     */
+    void Start(size_t helperThreadCount);
+    void Stop();
+
+    /**
+     * @brief Number of threads that may execute tasks, including the caller
+     * Worker indices passed to tasks are always below this value.
+     */
+    size_t GetParticipantCount() const { return m_queues.empty() ? 1 : m_queues.size(); }
+
+    /**
+     * @brief Run task(taskIndex, workerIndex) for every index in [0, taskCount) and wait for completion
+     */
+    void ParallelFor(size_t taskCount, const TaskFunction& task);
+
+    /**
+     * @brief Split [0, itemCount) into fixed-size ranges and run fn(first, last, rangeIndex, workerIndex) for each
+     * Range i always covers [i * rangeSize, min((i + 1) * rangeSize, itemCount)).
+     */
+    template<typename Fn>
+    void ParallelForRanges(uint32_t itemCount, uint32_t rangeSize, Fn&& fn) {
+        if (itemCount == 0 || rangeSize == 0) {
+            return;
+        }
+
+        const size_t rangeCount = (static_cast<size_t>(itemCount) + rangeSize - 1) / rangeSize;
+        ParallelFor(rangeCount, [&](size_t rangeIndex, size_t workerIndex) {
+            const uint32_t first = static_cast<uint32_t>(rangeIndex * rangeSize);
+            const uint32_t last = (itemCount - first > rangeSize) ? first + rangeSize : itemCount;
+            fn(first, last, rangeIndex, workerIndex);
+        });
+    }
+
+    /**
+     * @brief Number of ranges ParallelForRanges() will produce for the given sizes
+     */
+    static size_t RangeCount(uint32_t itemCount, uint32_t rangeSize) {
+        return rangeSize == 0 ? 0 : (static_cast<size_t>(itemCount) + rangeSize - 1) / rangeSize;
+    }
+
+private:
+    struct alignas(64) TaskQueue {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    void WorkerLoop(std::stop_token stopToken, size_t workerIndex);
+    bool TryPopLocal(size_t workerIndex, size_t& outTask);
+    bool TrySteal(size_t workerIndex, size_t& outTask);
+    void DrainTasks(size_t workerIndex);
+
+    std::vector<std::unique_ptr<TaskQueue>> m_queues;
+    std::vector<std::jthread> m_threads;
+
+    const TaskFunction* m_task = nullptr;           // Published before tasks are queued
+    std::atomic<size_t> m_remainingTasks{ 0 };
+    std::atomic<uint64_t> m_batchGeneration{ 0 };   // Bumped to wake helpers for a new batch
+};
+
+} // namespace kx